@@ -6,32 +6,68 @@
 
 #include "cpplexer.hpp"
 
-#include <fstream>
+#include <memory>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace cpplexer {
 
     namespace detail {
 
-        std::string token_range::read_file()
-        {
-            //  Open and read in the specified input file.
-            std::ifstream instream(input);
+        namespace {
+
+            constexpr wave::language_support file_language =
+                wave::language_support(wave::support_cpp |
+                    wave::support_cpp20 | wave::support_option_long_long |
+                    wave::support_option_include_guard_detection);
 
-            if (!instream.is_open())
+            // the given language options with lazy token values enabled or
+            // disabled as requested
+            wave::language_support with_token_values(
+                wave::language_support language, token_values values)
             {
-                throw std::runtime_error("Could not open input file: " + input);
+                language = wave::language_support(
+                    language & ~wave::support_option_lazy_token_values);
+                if (values == token_values::lazy)
+                {
+                    language = wave::language_support(
+                        language | wave::support_option_lazy_token_values);
+                }
+                return language;
             }
 
-            instream.unsetf(std::ios::skipws);
+            std::unique_ptr<wave::cpplexer::token_value_buffer>
+            make_value_buffer(token_values values)
+            {
+                if (values != token_values::lazy)
+                    return nullptr;
+                return std::make_unique<wave::cpplexer::token_value_buffer>();
+            }
+        }    // namespace
 
-            return {std::istreambuf_iterator<char>(instream.rdbuf()),
-                std::istreambuf_iterator<char>()};
+        token_range::token_range(
+            std::string const& input, token_values values_)
+          : input(input)
+          , instr(wave::cpplexer::read_file(input))
+          , language(with_token_values(file_language, values_))
+          , values(make_value_buffer(values_))
+          , lines(std::make_unique<line_index>())
+          , points(std::make_unique<checkpoint_index>(
+                std::vector<lexer_checkpoint>(1), language))
+        {
         }
 
-        token_range::token_range(std::string const& input)
+        token_range::token_range(std::string const& input,
+            checkpoint_index checkpoints, token_values values_)
           : input(input)
-          , instr(read_file())
+          , instr(wave::cpplexer::read_file(input))
+          , language(with_token_values(file_language, values_))
+          , values(make_value_buffer(values_))
+          , lines(std::make_unique<line_index>())
+          , points(std::make_unique<checkpoint_index>(std::move(checkpoints)))
+          , record_checkpoints(false)
         {
         }
 
@@ -39,9 +75,48 @@ namespace cpplexer {
         {
             position_type const pos(input);
 
-            return lexer_type(instr.begin(), instr.end(), pos,
-                wave::language_support(wave::support_cpp | wave::support_cpp20 |
-                    wave::support_option_long_long));
+            lexer_type first(instr.begin(), instr.end(), pos, language);
+
+            guards = wave::cpplexer::include_guards<token_type>();
+            first.set_include_guards(&guards);
+            if (nullptr != values)
+                first.set_value_buffer(values.get());
+            first.set_line_index(lines.get());
+            if (record_checkpoints)
+                first.set_checkpoint_index(points.get());
+            return first;
+        }
+
+        lexer_type token_range::begin_at_line(std::size_t line)
+        {
+            return begin_at(points->before_line(line));
+        }
+
+        lexer_type token_range::begin_at_offset(std::size_t offset)
+        {
+            return begin_at(points->before_offset(offset));
+        }
+
+        lexer_type token_range::begin_at(lexer_checkpoint const& checkpoint)
+        {
+            if (checkpoint.offset > instr.size())
+            {
+                throw std::out_of_range(
+                    "checkpoint beyond the end of the file: " + input);
+            }
+
+            position_type const pos(input, checkpoint.line, checkpoint.column);
+
+            // the checkpoints don't depend on how the values are held
+            lexer_type first(instr.begin() + checkpoint.offset, instr.end(),
+                pos,
+                with_token_values(points->language_options(),
+                    nullptr != values ? token_values::lazy :
+                                        token_values::owned));
+
+            if (nullptr != values)
+                first.set_value_buffer(values.get());
+            return first;
         }
 
         lexer_type token_range::end()
@@ -49,10 +124,160 @@ namespace cpplexer {
             return lexer_type();
         }
 
+        bool token_range::has_include_guards(std::string& guard_name) const
+        {
+            return guards.detected(guard_name);
+        }
+
+        line_index const& token_range::line_table() const
+        {
+            return *lines;
+        }
+
+        checkpoint_index const& token_range::checkpoints() const
+        {
+            return *points;
+        }
+
+        text_token_range::text_token_range(std::string_view text,
+            std::string_view name, wave::language_support language)
+          : text(text)
+          , name(name)
+          , language(language)
+        {
+        }
+
+        lexer_type text_token_range::begin()
+        {
+            position_type const pos{position_type::string_type(name)};
+
+            lexer_type first(text.data(), text.data() + text.size(), pos,
+                wave::language_support(
+                    language | wave::support_option_lazy_token_values));
+
+            first.set_value_buffer(&values);
+            return first;
+        }
+
+        lexer_type text_token_range::end()
+        {
+            return lexer_type();
+        }
+
+        stream_token_range::stream_token_range(
+            std::istream& instream, std::string const& name)
+          : name(name)
+          , input(std::make_unique<wave::cpplexer::istream_input>(instream))
+        {
+        }
+
+        stream_token_range::stream_token_range(int fd, std::string const& name)
+          : name(name)
+          , input(std::make_unique<wave::cpplexer::fd_input>(fd))
+        {
+        }
+
+        lexer_type stream_token_range::begin()
+        {
+            position_type const pos(name);
+
+            lexer_type first(wave::cpplexer::stream_input_ref(*input),
+                wave::cpplexer::stream_input_ref(), pos,
+                wave::language_support(wave::support_cpp | wave::support_cpp20 |
+                    wave::support_option_long_long |
+                    wave::support_option_include_guard_detection));
+
+            guards = wave::cpplexer::include_guards<token_type>();
+            first.set_include_guards(&guards);
+            return first;
+        }
+
+        lexer_type stream_token_range::end()
+        {
+            return lexer_type();
+        }
+
+        bool stream_token_range::has_include_guards(
+            std::string& guard_name) const
+        {
+            return guards.detected(guard_name);
+        }
+
+        dependency_range::dependency_range(std::string const& infile)
+          : instr(wave::cpplexer::read_file(infile))
+        {
+            wave::cpplexer::scan_dependencies(instr, directives);
+        }
+
+        dependency_range::iterator dependency_range::begin() const
+        {
+            return directives.begin();
+        }
+
+        dependency_range::iterator dependency_range::end() const
+        {
+            return directives.end();
+        }
+
     }    // namespace detail
 
-    detail::token_range tokenize(std::string const& input)
+    detail::token_range tokenize(std::string const& input, token_values values)
     {
-        return detail::token_range(input);
+        return detail::token_range(input, values);
+    }
+
+    detail::text_token_range tokenize(std::string_view text,
+        std::string_view virtual_name, wave::language_support language)
+    {
+        return detail::text_token_range(text, virtual_name, language);
+    }
+
+    generator<token_type> generate_tokens(std::string_view text,
+        std::string_view virtual_name, wave::language_support language)
+    {
+        return wave::cpplexer::generate_tokens(text.data(),
+            text.data() + text.size(),
+            position_type(position_type::string_type(virtual_name)),
+            language);
+    }
+
+    detail::stream_token_range tokenize(
+        std::istream& input, std::string const& name)
+    {
+        return detail::stream_token_range(input, name);
+    }
+
+    detail::stream_token_range tokenize(int fd, std::string const& name)
+    {
+        return detail::stream_token_range(fd, name);
+    }
+
+    void tokenize(std::string const& input, token_soa_buffer& tokens)
+    {
+        std::string const instr = wave::cpplexer::read_file(input);
+
+        wave::cpplexer::token_soa_gen<std::string::const_iterator>::lex(
+            instr.begin(), instr.end(), position_type(input),
+            wave::language_support(wave::support_cpp | wave::support_cpp20 |
+                wave::support_option_long_long),
+            tokens);
+    }
+
+    detail::dependency_range scan_dependencies(std::string const& input)
+    {
+        return detail::dependency_range(input);
+    }
+
+    token_fingerprint fingerprint(std::string const& input,
+        std::vector<declaration_fingerprint>* declarations)
+    {
+        std::string const instr = wave::cpplexer::read_file(input);
+
+        return wave::cpplexer::token_fingerprint_gen<
+            std::string::const_iterator>::fingerprint(instr.begin(),
+            instr.end(), position_type(input),
+            wave::language_support(wave::support_cpp | wave::support_cpp20 |
+                wave::support_option_long_long),
+            declarations);
     }
 }    // namespace cpplexer
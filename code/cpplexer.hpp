@@ -8,12 +8,27 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 // Include the lexer stuff
+#include "cpplexer/checkpoint_index.hpp"
 #include "cpplexer/cpp_lex_iterator.hpp"
 #include "cpplexer/cpp_lex_token.hpp"
 #include "cpplexer/cpplexer_exceptions.hpp"
 #include "cpplexer/cpplexer_gen.hpp"
+#include "cpplexer/dependency_scanner.hpp"
+#include "cpplexer/directory_lexer.hpp"
+#include "cpplexer/file_prefetcher.hpp"
+#include "cpplexer/identifier_interner.hpp"
+#include "cpplexer/lex_visitor.hpp"
+#include "cpplexer/numeric_literal.hpp"
+#include "cpplexer/reusable_lexer.hpp"
+#include "cpplexer/stream_input.hpp"
+#include "cpplexer/token_generator.hpp"
+#include "cpplexer/token_soa_buffer.hpp"
 
+#include <istream>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace cpplexer {
 
@@ -21,6 +36,13 @@ namespace cpplexer {
     using lexer_type = wave::cpplexer::lex_iterator<token_type>;
     using position_type = token_type::position_type;
 
+    // tokens having a line number but no column, the lexer producing these
+    // does not keep track of columns at all, which makes it faster
+    using line_token_type = wave::cpplexer::lex_token<
+        wave::util::file_position_without_column_type>;
+    using line_lexer_type = wave::cpplexer::lex_iterator<line_token_type>;
+    using line_position_type = line_token_type::position_type;
+
     using wave::token_id;
 
     using wave::BoolLiteralTokenType;
@@ -45,24 +67,204 @@ namespace cpplexer {
     using wave::InternalTokenType;
 
     using wave::get_token_name;
+    using wave::get_token_name_view;
     using wave::get_token_value;
+    using wave::get_token_value_view;
+
+    using wave::cpplexer::checkpoint_index;
+    using wave::cpplexer::decode_numeric_literal;
+    using wave::cpplexer::declaration_fingerprint;
+    using wave::cpplexer::dependency_directive;
+    using wave::cpplexer::directory_lexer_options;
+    using wave::cpplexer::directory_lexer_stats;
+    using wave::cpplexer::directory_sink;
+    using wave::cpplexer::file_prefetch_options;
+    using wave::cpplexer::file_prefetcher;
+    using wave::cpplexer::fingerprint;
+    using wave::cpplexer::fingerprint_builder;
+    using wave::cpplexer::generate_tokens;
+    using wave::cpplexer::generator;
+    using wave::cpplexer::hash_identifier;
+    using wave::cpplexer::identifier_interner;
+    using wave::cpplexer::interned_identifier;
+    using wave::cpplexer::lex;
+    using wave::cpplexer::lexer_checkpoint;
+    using wave::cpplexer::prefetched_file;
+    using wave::cpplexer::line_index;
+    using wave::cpplexer::no_symbol;
+    using wave::cpplexer::numeric_literal;
+    using wave::cpplexer::numeric_literal_kind;
+    using wave::cpplexer::numeric_suffix;
+    using wave::cpplexer::reusable_lexer;
+    using wave::cpplexer::scanner_buffer_options;
+    using wave::cpplexer::get_scanner_buffer_options;
+    using wave::cpplexer::set_scanner_buffer_options;
+    using wave::cpplexer::symbol_id;
+    using wave::cpplexer::trim_scanner_buffer_pool;
+    using wave::cpplexer::tokenize_directory;
+    using wave::cpplexer::token_fingerprint;
+    using wave::cpplexer::token_soa_buffer;
+    using wave::cpplexer::token_view;
+
+    // how the tokens of a file hold their values
+    enum class token_values
+    {
+        owned,    // each token holds a copy of its value
+        lazy      // the values are copied from the input only if accessed
+    };
 
     namespace detail {
 
+        // By default each token holds a copy of its value. If lazy token
+        // values are requested, the values of the tokens refer to the input
+        // held by this object and are copied only if accessed (see
+        // wave::support_option_lazy_token_values). Such tokens can't be
+        // used after the token_range was destroyed or begin() was called
+        // again.
         struct token_range
         {
-            token_range(std::string const& infile);
+            token_range(std::string const& infile,
+                token_values values_ = token_values::owned);
+
+            // use the checkpoints recorded by an earlier token_range for the
+            // same file instead of recording them again
+            token_range(std::string const& infile,
+                checkpoint_index checkpoints,
+                token_values values_ = token_values::owned);
 
             lexer_type begin();
             lexer_type end();
 
+            // start lexing at the last checkpoint preceding the given line
+            // (offset into the file), the first tokens returned may precede
+            // it. Neither the line table nor the checkpoints are recorded.
+            lexer_type begin_at_line(std::size_t line);
+            lexer_type begin_at_offset(std::size_t offset);
+
+            // returns true, if the file has an include guard or '#pragma once'
+            // (guard_name is empty in this case), valid only after the end of
+            // the token sequence has been reached
+            bool has_include_guards(std::string& guard_name) const;
+
+            // the start offsets of the lines of the file, allows to map the
+            // offsets of the token values to lines and columns (the lines
+            // are recorded as the input is read by the lexer)
+            line_index const& line_table() const;
+
+            // the checkpoints recorded by begin() every 64KB of the file (see
+            // wave::cpplexer::checkpoint_index), all of them are known only
+            // after the end of the token sequence has been reached
+            checkpoint_index const& checkpoints() const;
+
         private:
-            std::string read_file();
+            lexer_type begin_at(lexer_checkpoint const& checkpoint);
 
             std::string input;
             std::string instr;
+            wave::language_support language;
+            wave::cpplexer::include_guards<token_type> guards;
+            std::unique_ptr<wave::cpplexer::token_value_buffer> values;
+            std::unique_ptr<line_index> lines;
+            std::unique_ptr<checkpoint_index> points;
+            bool record_checkpoints = true;
+        };
+
+        // Lex text held in memory (i.e. a snippet of code), the text is not
+        // copied, it has to outlive this object and the tokens. Constructing
+        // this object allocates nothing. The values of the tokens refer to
+        // the input held by this object (see token_range), thus it can't be
+        // copied or moved.
+        struct text_token_range
+        {
+            text_token_range(std::string_view text, std::string_view name,
+                wave::language_support language);
+
+            text_token_range(text_token_range const&) = delete;
+            text_token_range& operator=(text_token_range const&) = delete;
+
+            lexer_type begin();
+            lexer_type end();
+
+        private:
+            std::string_view text;
+            std::string_view name;
+            wave::language_support language;
+            wave::cpplexer::token_value_buffer values;
+        };
+
+        // Lex input read in chunks from a stream, the memory required does not
+        // depend on the size of the input. The input can be iterated only once.
+        struct stream_token_range
+        {
+            stream_token_range(std::istream& instream, std::string const& name);
+            stream_token_range(int fd, std::string const& name);
+
+            lexer_type begin();
+            lexer_type end();
+
+            // see token_range::has_include_guards
+            bool has_include_guards(std::string& guard_name) const;
+
+        private:
+            std::string name;
+            std::unique_ptr<wave::cpplexer::stream_input> input;
+            wave::cpplexer::include_guards<token_type> guards;
+        };
+
+        // The #include directives and module declarations of a file, see
+        // wave::cpplexer::scan_dependencies. The directives refer to the file
+        // contents held by this object, thus it can't be copied or moved.
+        struct dependency_range
+        {
+            using iterator = std::vector<dependency_directive>::const_iterator;
+
+            dependency_range(std::string const& infile);
+
+            dependency_range(dependency_range const&) = delete;
+            dependency_range& operator=(dependency_range const&) = delete;
+
+            iterator begin() const;
+            iterator end() const;
+
+        private:
+            std::string instr;
+            std::vector<dependency_directive> directives;
         };
     }    // namespace detail
 
-    detail::token_range tokenize(std::string const& input);
+    detail::token_range tokenize(std::string const& input,
+        token_values values = token_values::owned);
+
+    // Lex the given text, the name is used in the positions of the tokens
+    detail::text_token_range tokenize(std::string_view text,
+        std::string_view virtual_name,
+        wave::language_support language = wave::language_support(
+            wave::support_cpp | wave::support_cpp20 |
+            wave::support_option_long_long));
+
+    // Lex the given text in a coroutine (see
+    // wave::cpplexer::generate_tokens), the text has to outlive the
+    // generator
+    generator<token_type> generate_tokens(std::string_view text,
+        std::string_view virtual_name,
+        wave::language_support language = wave::language_support(
+            wave::support_cpp | wave::support_cpp20 |
+            wave::support_option_long_long));
+
+    detail::stream_token_range tokenize(
+        std::istream& input, std::string const& name);
+    detail::stream_token_range tokenize(int fd, std::string const& name);
+
+    // Lex a file into the given token_soa_buffer (see
+    // wave::cpplexer::token_soa_gen), the buffer can be reused for the next
+    // file to avoid reallocating its arrays.
+    void tokenize(std::string const& input, token_soa_buffer& tokens);
+
+    detail::dependency_range scan_dependencies(std::string const& input);
+
+    // Compute the fingerprint of the significant tokens of a file (see
+    // wave::cpplexer::token_fingerprint_gen), optionally including the
+    // fingerprints of the top level declarations.
+    token_fingerprint fingerprint(std::string const& input,
+        std::vector<declaration_fingerprint>* declarations = nullptr);
 }    // namespace cpplexer
@@ -0,0 +1,221 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer::detail {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  bounded_queue
+    //
+    //      Lock-free multi-producer multi-consumer queue of a fixed capacity
+    //      (D. Vyukov's bounded MPMC queue): each cell carries a sequence
+    //      number telling whether it is ready to be written or read for the
+    //      current round, so producers and consumers only contend on their
+    //      own position counter.
+    //
+    //      try_push() and try_pop() never block. push() waits while the queue
+    //      is full and pop() waits while it is empty, the waiting threads
+    //      sleep (std::atomic::wait) and are woken only if a thread is known
+    //      to be waiting. close() wakes all of them, push() and pop() don't
+    //      wait for a closed queue anymore.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class bounded_queue
+    {
+    public:
+        // the capacity is rounded up to the next power of two
+        explicit bounded_queue(std::size_t capacity_)
+          : capacity(round_up(capacity_))
+          , cells(std::make_unique<cell[]>(capacity))
+        {
+            for (std::size_t i = 0; i != capacity; ++i)
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        bounded_queue(bounded_queue const&) = delete;
+        bounded_queue& operator=(bounded_queue const&) = delete;
+
+        [[nodiscard]] std::size_t max_size() const noexcept
+        {
+            return capacity;
+        }
+
+        bool try_push(T& value)
+        {
+            std::size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+            while (true)
+            {
+                cell& c = cells[pos & (capacity - 1)];
+                std::size_t const sequence =
+                    c.sequence.load(std::memory_order_acquire);
+                auto const diff = static_cast<std::ptrdiff_t>(sequence - pos);
+                if (diff == 0)
+                {
+                    if (enqueue_pos.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        c.value = std::move(value);
+                        c.sequence.store(pos + 1, std::memory_order_release);
+                        notify(pushed, pop_waiters);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // full
+                }
+                else
+                {
+                    pos = enqueue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool try_pop(T& value)
+        {
+            std::size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+            while (true)
+            {
+                cell& c = cells[pos & (capacity - 1)];
+                std::size_t const sequence =
+                    c.sequence.load(std::memory_order_acquire);
+                auto const diff =
+                    static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+                if (diff == 0)
+                {
+                    if (dequeue_pos.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        value = std::move(c.value);
+                        c.sequence.store(
+                            pos + capacity, std::memory_order_release);
+                        notify(popped, push_waiters);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // empty
+                }
+                else
+                {
+                    pos = dequeue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // returns false if the queue was closed before the value could be
+        // pushed
+        bool push(T value)
+        {
+            bool pushed_value = false;
+            auto const done = [&] {
+                pushed_value = try_push(value);
+                return pushed_value || closed.load();
+            };
+            while (!done())
+            {
+                if (wait(popped, push_waiters, done))
+                    break;
+            }
+            return pushed_value;
+        }
+
+        // returns false if the queue was closed while it was empty
+        bool pop(T& value)
+        {
+            bool popped_value = false;
+            auto const done = [&] {
+                popped_value = try_pop(value);
+                return popped_value || closed.load();
+            };
+            while (!done())
+            {
+                if (wait(pushed, pop_waiters, done))
+                    break;
+            }
+            return popped_value;
+        }
+
+        // wake all waiting threads
+        void close() noexcept
+        {
+            closed.store(true);
+            pushed.fetch_add(1);
+            pushed.notify_all();
+            popped.fetch_add(1);
+            popped.notify_all();
+        }
+
+    private:
+        struct cell
+        {
+            std::atomic<std::size_t> sequence;
+            T value;
+        };
+
+        static std::size_t round_up(std::size_t n) noexcept
+        {
+            std::size_t result = 2;
+            while (result < n)
+                result *= 2;
+            return result;
+        }
+
+        // wake the threads waiting for the given counter to change
+        static void notify(std::atomic<std::uint32_t>& counter,
+            std::atomic<std::uint32_t>& waiters) noexcept
+        {
+            counter.fetch_add(1);
+            if (waiters.load() != 0)
+                counter.notify_all();
+        }
+
+        // sleep until the counter changes, unless retry() succeeds after
+        // registering as a waiter (the notifying side increments the counter
+        // before looking for waiters, thus no wake up is lost), returns the
+        // result of retry()
+        template <typename Retry>
+        static bool wait(std::atomic<std::uint32_t>& counter,
+            std::atomic<std::uint32_t>& waiters, Retry&& retry)
+        {
+            std::uint32_t const seen = counter.load();
+            waiters.fetch_add(1);
+            bool const done = retry();
+            if (!done)
+                counter.wait(seen);
+            waiters.fetch_sub(1);
+            return done;
+        }
+
+        std::size_t const capacity;
+        std::unique_ptr<cell[]> cells;
+
+        alignas(64) std::atomic<std::size_t> enqueue_pos{0};
+        alignas(64) std::atomic<std::size_t> dequeue_pos{0};
+
+        alignas(64) std::atomic<std::uint32_t> pushed{0};
+        std::atomic<std::uint32_t> pop_waiters{0};
+        alignas(64) std::atomic<std::uint32_t> popped{0};
+        std::atomic<std::uint32_t> push_waiters{0};
+
+        std::atomic<bool> closed{false};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer::detail
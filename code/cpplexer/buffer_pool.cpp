@@ -0,0 +1,199 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "buffer_pool.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    namespace {
+
+        constexpr std::size_t min_buffer_size = 64;
+        constexpr std::size_t min_pooled_size = 4096;
+        constexpr std::size_t huge_page_size = std::size_t(2) * 1024 * 1024;
+
+        std::atomic<std::size_t> buffer_size{196608};
+        std::atomic<std::size_t> max_pooled_buffers{4};
+        std::atomic<bool> huge_pages{false};
+
+        struct pooled_buffer
+        {
+            unsigned char* data;
+            std::size_t size;
+        };
+
+        // set once the pool of the thread was destroyed, buffers released
+        // afterwards (i.e. by static objects) are freed directly
+        thread_local bool pool_destroyed = false;
+
+        class buffer_pool
+        {
+        public:
+            ~buffer_pool()
+            {
+                trim();
+                pool_destroyed = true;
+            }
+
+            // the smallest pooled buffer having at least the given size
+            unsigned char* take(std::size_t& size) noexcept
+            {
+                auto best = buffers.end();
+                for (auto it = buffers.begin(); it != buffers.end(); ++it)
+                {
+                    if (it->size >= size &&
+                        (best == buffers.end() || it->size < best->size))
+                    {
+                        best = it;
+                    }
+                }
+                if (best == buffers.end())
+                    return nullptr;
+
+                unsigned char* const result = best->data;
+                size = best->size;
+                *best = buffers.back();
+                buffers.pop_back();
+                return result;
+            }
+
+            bool put(unsigned char* data, std::size_t size) noexcept
+            {
+                if (buffers.size() >=
+                    max_pooled_buffers.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+
+                try
+                {
+                    buffers.push_back(pooled_buffer{data, size});
+                }
+                catch (std::bad_alloc const&)
+                {
+                    return false;
+                }
+                return true;
+            }
+
+            void trim() noexcept
+            {
+                for (pooled_buffer const& buffer : buffers)
+                    std::free(buffer.data);
+                buffers.clear();
+            }
+
+        private:
+            std::vector<pooled_buffer> buffers;
+        };
+
+        buffer_pool& get_pool() noexcept
+        {
+            thread_local buffer_pool pool;
+            return pool;
+        }
+
+        bool is_poolable(std::size_t size) noexcept
+        {
+            return size >= min_pooled_size &&
+                size / 16 <= buffer_size.load(std::memory_order_relaxed) &&
+                !pool_destroyed;
+        }
+
+        unsigned char* allocate_huge(std::size_t& size) noexcept
+        {
+#if defined(__linux__)
+            std::size_t const rounded =
+                (size + huge_page_size - 1) & ~(huge_page_size - 1);
+            void* const data = std::aligned_alloc(huge_page_size, rounded);
+            if (nullptr != data)
+            {
+                // only a hint, the buffer is usable if this fails
+                ::madvise(data, rounded, MADV_HUGEPAGE);
+                size = rounded;
+            }
+            return static_cast<unsigned char*>(data);
+#else
+            return static_cast<unsigned char*>(std::malloc(size));
+#endif
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void set_scanner_buffer_options(scanner_buffer_options const& options)
+    {
+        if (options.buffer_size < min_buffer_size)
+        {
+            throw std::invalid_argument(
+                "scanner buffer size must be at least 64 bytes");
+        }
+
+        buffer_size.store(options.buffer_size, std::memory_order_relaxed);
+        max_pooled_buffers.store(
+            options.max_pooled_buffers, std::memory_order_relaxed);
+        huge_pages.store(options.huge_pages, std::memory_order_relaxed);
+    }
+
+    scanner_buffer_options get_scanner_buffer_options() noexcept
+    {
+        return scanner_buffer_options{
+            buffer_size.load(std::memory_order_relaxed),
+            max_pooled_buffers.load(std::memory_order_relaxed),
+            huge_pages.load(std::memory_order_relaxed)};
+    }
+
+    void trim_scanner_buffer_pool() noexcept
+    {
+        if (!pool_destroyed)
+            get_pool().trim();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        std::size_t scanner_buffer_size() noexcept
+        {
+            return buffer_size.load(std::memory_order_relaxed);
+        }
+
+        unsigned char* allocate_scanner_buffer(std::size_t& size) noexcept
+        {
+            if (is_poolable(size))
+            {
+                if (unsigned char* const data = get_pool().take(size))
+                    return data;
+            }
+
+            if (size >= huge_page_size &&
+                huge_pages.load(std::memory_order_relaxed))
+            {
+                return allocate_huge(size);
+            }
+            return static_cast<unsigned char*>(std::malloc(size));
+        }
+
+        void release_scanner_buffer(
+            unsigned char* buffer, std::size_t size) noexcept
+        {
+            if (nullptr == buffer)
+                return;
+
+            if (!is_poolable(size) || !get_pool().put(buffer, size))
+                std::free(buffer);
+        }
+    }    // namespace detail
+}    // namespace wave::cpplexer
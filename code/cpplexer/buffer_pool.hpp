@@ -0,0 +1,62 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  scanner_buffer_options
+    //
+    //      The scanners read their input in chunks of buffer_size bytes into
+    //      buffers borrowed from a pool owned by the calling thread. A buffer
+    //      goes back to the pool of the thread releasing it, i.e. destroying
+    //      the lexer or resetting the token_value_buffer retaining the input.
+    //      Each pool keeps up to max_pooled_buffers buffers, buffers smaller
+    //      than 4KB or larger than 16 times buffer_size are freed instead.
+    //
+    //      If huge_pages is set, buffers of 2MB and more are allocated in
+    //      multiples of 2MB and marked as candidates for transparent huge
+    //      pages (Linux only, ignored elsewhere).
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    struct scanner_buffer_options
+    {
+        std::size_t buffer_size = 196608;    // at least 64 bytes
+        std::size_t max_pooled_buffers = 4;
+        bool huge_pages = false;
+    };
+
+    // the options apply to the buffers allocated afterwards by all threads
+    void set_scanner_buffer_options(scanner_buffer_options const& options);
+    scanner_buffer_options get_scanner_buffer_options() noexcept;
+
+    // free the buffers pooled by the calling thread
+    void trim_scanner_buffer_pool() noexcept;
+
+    namespace detail {
+
+        // the number of bytes a scanner reads at once
+        std::size_t scanner_buffer_size() noexcept;
+
+        // allocate a buffer of at least the given number of bytes (size is
+        // set to the actual capacity), returns nullptr if out of memory
+        unsigned char* allocate_scanner_buffer(std::size_t& size) noexcept;
+
+        // return a buffer allocated by allocate_scanner_buffer (or
+        // std::malloc), size is its capacity
+        void release_scanner_buffer(
+            unsigned char* buffer, std::size_t size) noexcept;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
@@ -0,0 +1,52 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "checkpoint_index.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    checkpoint_index::checkpoint_index(
+        std::vector<lexer_checkpoint> checkpoints, language_support language_,
+        std::size_t interval)
+      : points(std::move(checkpoints))
+      , every(interval)
+      , language(language_)
+    {
+        if (points.empty())
+        {
+            throw std::invalid_argument(
+                "checkpoint_index: at least one checkpoint is required");
+        }
+    }
+
+    lexer_checkpoint const& checkpoint_index::before_line(
+        std::size_t line) const noexcept
+    {
+        // the first checkpoint at the given line may follow a token of it
+        auto const it = std::lower_bound(points.begin() + 1, points.end(),
+            line, [](lexer_checkpoint const& point, std::size_t value) {
+                return point.line < value;
+            });
+        return *(it - 1);
+    }
+
+    lexer_checkpoint const& checkpoint_index::before_offset(
+        std::size_t offset) const noexcept
+    {
+        auto const it = std::upper_bound(points.begin() + 1, points.end(),
+            offset, [](std::size_t value, lexer_checkpoint const& point) {
+                return value < point.offset;
+            });
+        return *(it - 1);
+    }
+}    // namespace wave::cpplexer
@@ -0,0 +1,120 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+#include "language_support.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  the state of a lexer in between two tokens
+    struct lexer_checkpoint
+    {
+        std::size_t offset = 0;    // of the next character of the input
+        std::size_t line = 1;      // of the next token
+        std::size_t column = 1;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  checkpoint_index
+    //
+    //      Checkpoints of a lexer recorded every 'interval' bytes of its
+    //      input (see lex_iterator::set_checkpoint_index). Lexing can be
+    //      resumed at a checkpoint by starting a new lexer at its offset and
+    //      position with the language options stored in the index, the tokens
+    //      returned are the same as the ones returned by the original lexer.
+    //      Thus reaching a certain line requires to lex at most 'interval'
+    //      bytes before it instead of the whole input.
+    //
+    //      A checkpoint is taken at the first token boundary after the
+    //      interval has passed. The offsets refer to the input of the lexer
+    //      as is (i.e. including the line splices), the first checkpoint is
+    //      the start of the input. The index holds plain values only, it can
+    //      be stored and constructed again from them.
+    //
+    //      The include guard detection doesn't work for a resumed lexer.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    class checkpoint_index
+    {
+    public:
+        static constexpr std::size_t default_interval = 64 * 1024;
+
+        explicit checkpoint_index(std::size_t interval = default_interval)
+          : points(1)
+          , every(interval)
+        {
+        }
+
+        // 'checkpoints' have to be in ascending order and must not be empty
+        checkpoint_index(std::vector<lexer_checkpoint> checkpoints,
+            language_support language,
+            std::size_t interval = default_interval);
+
+        // start recording a new input lexed with the given language options
+        void clear(language_support language_, lexer_checkpoint const& start)
+        {
+            points.assign(1, start);
+            language = language_;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return points.size();
+        }
+
+        [[nodiscard]] std::span<lexer_checkpoint const> checkpoints()
+            const noexcept
+        {
+            return points;
+        }
+
+        [[nodiscard]] std::size_t interval() const noexcept
+        {
+            return every;
+        }
+
+        // the language options of the lexer the checkpoints were recorded by
+        [[nodiscard]] language_support language_options() const noexcept
+        {
+            return language;
+        }
+
+        // the last checkpoint preceding all tokens starting at the given line
+        [[nodiscard]] lexer_checkpoint const& before_line(
+            std::size_t line) const noexcept;
+
+        // the last checkpoint at or before the given offset
+        [[nodiscard]] lexer_checkpoint const& before_offset(
+            std::size_t offset) const noexcept;
+
+        // a new checkpoint is due at the given offset
+        [[nodiscard]] bool is_due(std::size_t offset) const noexcept
+        {
+            return offset - points.back().offset >= every;
+        }
+
+        void add(lexer_checkpoint const& checkpoint)
+        {
+            points.push_back(checkpoint);
+        }
+
+    private:
+        std::vector<lexer_checkpoint> points;
+        std::size_t every;
+        language_support language = language_support();
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
@@ -295,6 +295,32 @@ namespace wave {
     using uint_literal_type = unsigned long long;
 }    // namespace wave
 
+///////////////////////////////////////////////////////////////////////////////
+//  Use SSE2 instructions for skipping the text of comments, if these are
+//  available on the target platform. Define WAVE_USE_SSE2 to 0 to use the
+//  portable implementation.
+#if !defined(WAVE_USE_SSE2)
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WAVE_USE_SSE2 1
+#else
+#define WAVE_USE_SSE2 0
+#endif
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+//  Read files ahead using io_uring on Linux (see file_prefetcher), if the
+//  kernel headers are available. The file_prefetcher falls back to a thread
+//  pool if io_uring is not supported by the running kernel. Define
+//  WAVE_USE_IO_URING to 0 to always use the thread pool.
+#if !defined(WAVE_USE_IO_URING)
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define WAVE_USE_IO_URING 1
+#else
+#define WAVE_USE_IO_URING 0
+#endif
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 //  On some platforms Wave will not be able to properly detect whether wchar_t
 //  is representing a signed or unsigned integral data type. Use the
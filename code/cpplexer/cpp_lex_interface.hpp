@@ -13,11 +13,18 @@
 #pragma once
 
 #include "config.hpp"
+#include "detect_include_guards.hpp"
 #include "file_position.hpp"
+#include "token_value_buffer.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace wave::cpplexer {
 
+    class checkpoint_index;
+    class error_sink;
+    class identifier_interner;
+    class line_index;
+
     ///////////////////////////////////////////////////////////////////////////////
     //
     //  The lex_input_interface decouples the lex_iterator_shim from the actual
@@ -35,7 +42,15 @@ namespace wave::cpplexer {
         virtual ~lex_input_interface() = default;
 
         virtual TokenT& get(TokenT&) = 0;
+        virtual TokenT& skip_to_matching_conditional(TokenT&) = 0;
         virtual void set_position(position_type const& pos) = 0;
+        virtual void set_include_guards(include_guards<TokenT>* guards) = 0;
+        virtual void set_value_buffer(token_value_buffer* buffer) = 0;
+        virtual void set_error_sink(error_sink* errors) = 0;
+        virtual void set_line_index(line_index* lines) = 0;
+        virtual void set_checkpoint_index(checkpoint_index* index) = 0;
+        virtual void set_identifier_interner(
+            identifier_interner* interner) = 0;
     };
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <string>
 
 #include "config.hpp"
@@ -59,11 +60,60 @@ namespace wave::cpplexer {
                 delete mp.shared()->ftor;
             }
 
+            // replace the current token by the token terminating the skipped
+            // conditional block
+            template <typename MultiPass>
+            static void skip_to_matching_conditional(MultiPass& mp)
+            {
+                mp.shared()->ftor->skip_to_matching_conditional(
+                    mp.shared()->curtok);
+            }
+
             template <typename MultiPass>
             static void set_position(MultiPass& mp, position_type const& pos)
             {
                 mp.shared()->ftor->set_position(pos);
             }
+
+            template <typename MultiPass>
+            static void set_include_guards(
+                MultiPass& mp, include_guards<TokenT>* guards)
+            {
+                mp.shared()->ftor->set_include_guards(guards);
+            }
+
+            template <typename MultiPass>
+            static void set_value_buffer(
+                MultiPass& mp, token_value_buffer* buffer)
+            {
+                mp.shared()->ftor->set_value_buffer(buffer);
+            }
+
+            template <typename MultiPass>
+            static void set_error_sink(MultiPass& mp, error_sink* errors)
+            {
+                mp.shared()->ftor->set_error_sink(errors);
+            }
+
+            template <typename MultiPass>
+            static void set_line_index(MultiPass& mp, line_index* lines)
+            {
+                mp.shared()->ftor->set_line_index(lines);
+            }
+
+            template <typename MultiPass>
+            static void set_checkpoint_index(
+                MultiPass& mp, checkpoint_index* index)
+            {
+                mp.shared()->ftor->set_checkpoint_index(index);
+            }
+
+            template <typename MultiPass>
+            static void set_identifier_interner(
+                MultiPass& mp, identifier_interner* interner)
+            {
+                mp.shared()->ftor->set_identifier_interner(interner);
+            }
         };
 
         ///////////////////////////////////////////////////////////////////////////////
@@ -167,6 +217,83 @@ namespace wave::cpplexer {
             }
             unique_functor_type::set_position(*this, currpos);
         }
+
+        // Attach an include guard detector which will see all tokens returned
+        // by the lexer from now on (if the language option
+        // support_option_include_guard_detection is set). It has to be
+        // attached before the first token is dereferenced to see the whole
+        // file.
+        void set_include_guards(include_guards<TokenT>* guards)
+        {
+            unique_functor_type::set_include_guards(*this, guards);
+        }
+
+        // Retain the lexer input in the given buffer, the values of the
+        // returned tokens refer to it and are copied only when get_value()
+        // is called for the first time (values needing trigraph conversion
+        // are copied right away). This is done only if the language option
+        // support_option_lazy_token_values is set, in which case the buffer
+        // has to outlive all tokens. It has to be attached before the first
+        // token is dereferenced.
+        void set_value_buffer(token_value_buffer* buffer)
+        {
+            unique_functor_type::set_value_buffer(*this, buffer);
+        }
+
+        // Report the diagnostics of the lexer to the given sink instead of
+        // throwing a lexing_exception for each of them. The lexer continues
+        // after a reported diagnostic (see error_sink), thus a file with many
+        // errors is scanned without any exception being thrown.
+        void set_error_sink(error_sink* errors)
+        {
+            unique_functor_type::set_error_sink(*this, errors);
+        }
+
+        // Record the start offsets of the lines of the input in the given
+        // index while the input is read (see line_index), which allows to
+        // map the offsets of lazy token values back to lines and columns.
+        // It has to be attached before the first token is dereferenced.
+        void set_line_index(line_index* lines)
+        {
+            unique_functor_type::set_line_index(*this, lines);
+        }
+
+        // Record checkpoints of the lexer in the given index while lexing
+        // (see checkpoint_index). A new lex_iterator started at one of them
+        // returns the same tokens as this one from there on. It has to be
+        // attached before the first token is dereferenced.
+        void set_checkpoint_index(checkpoint_index* index)
+        {
+            unique_functor_type::set_checkpoint_index(*this, index);
+        }
+
+        // Intern the identifiers returned from now on in the given interner
+        // (which may be shared by several lexers), their ids are available
+        // from token_type::get_symbol(). The tokens of identifiers interned
+        // by the same interner are compared by their ids, all others by their
+        // values.
+        void set_identifier_interner(identifier_interner* interner)
+        {
+            unique_functor_type::set_identifier_interner(*this, interner);
+        }
+
+        // Skip the lines following the current token up to the #elif, #else,
+        // or #endif directive terminating the current conditional block,
+        // nested conditional blocks are skipped as a whole. The skipped lines
+        // are not tokenized at all.
+        //
+        // The current token has to be the newline terminating the directive
+        // line which opened the block and it has to be the last token read
+        // from the lexer (i.e. no copy of this iterator may have been advanced
+        // further). Afterwards the current token is the directive terminating
+        // the block (the rest of its line is returned by the following
+        // tokens) or T_EOF.
+        void skip_to_matching_conditional()
+        {
+            assert(this->queued_position ==
+                this->shared()->queued_elements.size());
+            unique_functor_type::skip_to_matching_conditional(*this);
+        }
     };
 
     ///////////////////////////////////////////////////////////////////////////////
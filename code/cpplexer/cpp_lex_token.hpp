@@ -14,11 +14,18 @@
 
 #include "config.hpp"
 #include "file_position.hpp"
+#include "identifier_interner.hpp"
+#include "numeric_literal.hpp"
 #include "token_ids.hpp"
+#include "token_value_buffer.hpp"
 
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <mutex>
 #include <optional>
+#include <string_view>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace wave::cpplexer {
@@ -47,8 +54,10 @@ namespace wave::cpplexer {
             }
 
             token_data(token_id id_, string_type value_, position_type pos_,
-                std::optional<position_type> expand_pos_ = std::nullopt)
+                std::optional<position_type> expand_pos_ = std::nullopt,
+                interned_identifier const& identifier_ = {})
               : id(id_)
+              , identifier(identifier_)
               , value(std::move(value_))
               , pos(std::move(pos_))
               , expand_pos(std::move(expand_pos_))
@@ -56,13 +65,30 @@ namespace wave::cpplexer {
             {
             }
 
+            //  the value is materialized on first access only
+            token_data(token_id id_, token_value_ref const& value_,
+                position_type pos_, interned_identifier const& identifier_ = {})
+              : id(id_)
+              , identifier(identifier_)
+              , lazy_buffer(value_.buffer)
+              , lazy_offset(value_.offset)
+              , lazy_length(value_.length)
+              , pos(std::move(pos_))
+              , refcnt(1)
+            {
+            }
+
             token_data(token_data const& rhs)
               : id(rhs.id)
-              , value(rhs.value)
+              , identifier(rhs.identifier)
+              , lazy_offset(rhs.lazy_offset)
+              , lazy_length(rhs.lazy_length)
               , pos(rhs.pos)
               , expand_pos(rhs.expand_pos)
+              , number(rhs.number)
               , refcnt(1)
             {
+                copy_value(rhs);
             }
 
             ~token_data() = default;
@@ -87,16 +113,48 @@ namespace wave::cpplexer {
                 return id;
             }
 
-            [[nodiscard]] string_type const& get_value() const noexcept
+            //  the value of a token referring to a token_value_buffer is
+            //  materialized by the first call (which may throw)
+            [[nodiscard]] string_type const& get_value() const
             {
+                if (token_value_buffer const* buffer =
+                        lazy_buffer.load(std::memory_order_acquire);
+                    nullptr != buffer)
+                {
+                    materialize_value(*buffer);
+                }
                 return value;
             }
 
+            //  the value without materializing it
+            [[nodiscard]] std::string_view get_value_view() const noexcept
+            {
+                if (token_value_buffer const* buffer =
+                        lazy_buffer.load(std::memory_order_acquire);
+                    nullptr != buffer)
+                {
+                    return {buffer->get(lazy_offset), lazy_length};
+                }
+                return {value.data(), value.size()};
+            }
+
             [[nodiscard]] position_type const& get_position() const noexcept
             {
                 return pos;
             }
 
+            [[nodiscard]] interned_identifier const& get_identifier()
+                const noexcept
+            {
+                return identifier;
+            }
+
+            [[nodiscard]] numeric_literal const& get_numeric_literal()
+                const noexcept
+            {
+                return number;
+            }
+
             [[nodiscard]] position_type const& get_expand_position()
                 const noexcept
             {
@@ -112,6 +170,9 @@ namespace wave::cpplexer {
             void set_value(string_type const& value_)
             {
                 value = value_;
+                lazy_buffer.store(nullptr, std::memory_order_relaxed);
+                identifier = interned_identifier();
+                number = numeric_literal();
             }
             void set_position(position_type const& pos_)
             {
@@ -121,13 +182,25 @@ namespace wave::cpplexer {
             {
                 expand_pos = pos_;
             }
+            void set_numeric_literal(numeric_literal const& number_) noexcept
+            {
+                number = number_;
+            }
 
             friend bool operator==(
                 token_data const& lhs, token_data const& rhs) noexcept
             {
                 //  two tokens are considered equal even if they refer to different
-                //  positions
-                return lhs.id == rhs.id && lhs.value == rhs.value;
+                //  positions, identifiers interned by the same interner are
+                //  compared by their id
+                if (nullptr != lhs.identifier.interner &&
+                    lhs.identifier.interner == rhs.identifier.interner)
+                {
+                    return lhs.id == rhs.id &&
+                        lhs.identifier.id == rhs.identifier.id;
+                }
+                return lhs.id == rhs.id &&
+                    lhs.get_value_view() == rhs.get_value_view();
             }
             friend bool operator!=(
                 token_data const& lhs, token_data const& rhs) noexcept
@@ -142,16 +215,23 @@ namespace wave::cpplexer {
             {
                 assert(refcnt == 1);
                 id = id_;
+                identifier = interned_identifier();
                 value = value_;
+                lazy_buffer.store(nullptr, std::memory_order_relaxed);
                 pos = pos_;
+                number = numeric_literal();
             }
 
             void init(token_data const& rhs)
             {
                 assert(refcnt == 1);
                 id = rhs.id;
-                value = rhs.value;
+                identifier = rhs.identifier;
+                lazy_offset = rhs.lazy_offset;
+                lazy_length = rhs.lazy_length;
+                copy_value(rhs);
                 pos = rhs.pos;
+                number = rhs.number;
             }
 
             void* operator new(std::size_t size);
@@ -159,11 +239,43 @@ namespace wave::cpplexer {
             void operator delete(void* p, std::size_t size);
 
         private:
-            token_id id;          // the token id
-            string_type value;    // the text that was parsed into this token
+            //  the token data may be shared by tokens used on different
+            //  threads, the value is written once only (holding the mutex of
+            //  the buffer) and is published by resetting lazy_buffer
+            void materialize_value(token_value_buffer const& buffer) const
+            {
+                std::lock_guard<std::mutex> l(buffer.value_mutex);
+                if (nullptr != lazy_buffer.load(std::memory_order_relaxed))
+                {
+                    value.assign(buffer.get(lazy_offset), lazy_length);
+                    lazy_buffer.store(nullptr, std::memory_order_release);
+                }
+            }
+
+            void copy_value(token_data const& rhs)
+            {
+                token_value_buffer const* buffer =
+                    rhs.lazy_buffer.load(std::memory_order_acquire);
+                if (nullptr == buffer)
+                    value = rhs.value;
+                lazy_buffer.store(buffer, std::memory_order_relaxed);
+            }
+
+            token_id id;    // the token id
+            // the id of an interned identifier (see identifier_interner)
+            interned_identifier identifier;
+            // the text that was parsed into this token, or the reference to
+            // it (if lazy_buffer isn't null)
+            mutable string_type value;
+            mutable std::atomic<token_value_buffer const*> lazy_buffer =
+                nullptr;
+            std::uint32_t lazy_offset = 0;
+            std::uint32_t lazy_length = 0;
             position_type pos;    // the original file position
             // where was this token expanded
             std::optional<position_type> expand_pos;
+            // the decoded value of a numeric literal
+            numeric_literal number;
             std::size_t refcnt;
         };
 
@@ -232,9 +344,16 @@ namespace wave::cpplexer {
                 data->addref();
         }
 
-        lex_token(
-            token_id id_, string_type const& value_, PositionT const& pos_)
-          : data(new data_type(id_, value_, pos_))
+        lex_token(token_id id_, string_type const& value_,
+            PositionT const& pos_, interned_identifier const& identifier_ = {})
+          : data(new data_type(id_, value_, pos_, std::nullopt, identifier_))
+        {
+        }
+
+        //  the referenced value is materialized by the first get_value()
+        lex_token(token_id id_, token_value_ref const& value_,
+            PositionT const& pos_, interned_identifier const& identifier_ = {})
+          : data(new data_type(id_, value_, pos_, identifier_))
         {
         }
 
@@ -265,7 +384,9 @@ namespace wave::cpplexer {
             return nullptr != data ? static_cast<token_id>(*data) : T_EOI;
         }
 
-        [[nodiscard]] string_type const& get_value() const noexcept
+        //  the value of a token created with a token_value_ref is
+        //  materialized by the first call, thus this may throw
+        [[nodiscard]] string_type const& get_value() const
         {
             return data->get_value();
         }
@@ -280,6 +401,28 @@ namespace wave::cpplexer {
             return data->get_expand_position();
         }
 
+        // the id of the identifier in the identifier_interner of the lexer,
+        // no_symbol if the lexer had none (or for other tokens)
+        [[nodiscard]] symbol_id get_symbol() const noexcept
+        {
+            return nullptr != data ? data->get_identifier().id : no_symbol;
+        }
+
+        // the interner which assigned the id returned by get_symbol()
+        [[nodiscard]] identifier_interner const* get_interner() const noexcept
+        {
+            return nullptr != data ? data->get_identifier().interner : nullptr;
+        }
+
+        // the value of a numeric literal decoded by the lexer, if the
+        // language option support_option_decode_numeric_literals was set
+        // (its kind is numeric_literal_kind::none otherwise)
+        [[nodiscard]] numeric_literal get_numeric_literal() const noexcept
+        {
+            return nullptr != data ? data->get_numeric_literal() :
+                                     numeric_literal();
+        }
+
         [[nodiscard]] bool is_eoi() const noexcept
         {
             return nullptr == data || static_cast<token_id>(*data) == T_EOI;
@@ -310,6 +453,11 @@ namespace wave::cpplexer {
             make_unique();
             data->set_expand_position(pos_);
         }
+        void set_numeric_literal(numeric_literal const& number_)
+        {
+            make_unique();
+            data->set_numeric_literal(number_);
+        }
 
         friend bool operator==(
             lex_token const& lhs, lex_token const& rhs) noexcept
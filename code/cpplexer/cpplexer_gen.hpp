@@ -14,14 +14,48 @@
 #include "config.hpp"
 #include "cpp_lex_iterator.hpp"
 #include "cpp_lex_token.hpp"
+#include "reusable_lexer.hpp"
+#include "stream_input.hpp"
+#include "token_fingerprint.hpp"
 #include "token_ids.hpp"
+#include "token_soa_buffer.hpp"
 
 #include <string>
 
 ///////////////////////////////////////////////////////////////////////////////
 //  The following file needs to be included only once throughout the whole
 //  program.
+#include "re2clex/cpp_re2c_fingerprint.hpp"
 #include "re2clex/cpp_re2c_lexer.hpp"
+#include "re2clex/cpp_re2c_reusable.hpp"
+#include "re2clex/cpp_re2c_soa.hpp"
 
 template struct wave::cpplexer::new_lexer_gen<std::string::iterator>;
 template struct wave::cpplexer::new_lexer_gen<std::string::const_iterator>;
+template struct wave::cpplexer::new_lexer_gen<
+    wave::cpplexer::stream_input_ref>;
+template struct wave::cpplexer::new_lexer_gen<char const*>;
+
+template struct wave::cpplexer::new_lexer_gen<std::string::iterator,
+    wave::util::file_position_without_column_type>;
+template struct wave::cpplexer::new_lexer_gen<std::string::const_iterator,
+    wave::util::file_position_without_column_type>;
+template struct wave::cpplexer::new_lexer_gen<
+    wave::cpplexer::stream_input_ref,
+    wave::util::file_position_without_column_type>;
+
+template struct wave::cpplexer::token_fingerprint_gen<std::string::iterator>;
+template struct wave::cpplexer::token_fingerprint_gen<
+    std::string::const_iterator>;
+template struct wave::cpplexer::token_fingerprint_gen<
+    wave::cpplexer::stream_input_ref>;
+
+template struct wave::cpplexer::token_soa_gen<std::string::iterator>;
+template struct wave::cpplexer::token_soa_gen<std::string::const_iterator>;
+template struct wave::cpplexer::token_soa_gen<
+    wave::cpplexer::stream_input_ref>;
+
+template class wave::cpplexer::reusable_lexer<std::string::const_iterator>;
+template class wave::cpplexer::reusable_lexer<char const*>;
+template class wave::cpplexer::reusable_lexer<
+    wave::cpplexer::stream_input_ref>;
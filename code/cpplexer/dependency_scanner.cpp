@@ -0,0 +1,657 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "dependency_scanner.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#if WAVE_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        //  The characters which need to be looked at while skipping over
+        //  uninteresting parts of the input.
+        constexpr std::array<bool, 256> make_interesting_chars() noexcept
+        {
+            std::array<bool, 256> result{};
+            for (char const c : std::string_view("\n\r\"'/\\"))
+                result[static_cast<unsigned char>(c)] = true;
+            return result;
+        }
+
+        constexpr std::array<bool, 256> interesting_chars =
+            make_interesting_chars();
+
+        // the position of the first interesting character at or after 'pos',
+        // or the size of the input
+        std::size_t find_interesting(
+            std::string_view input, std::size_t pos) noexcept
+        {
+            char const* p = input.data() + pos;
+            char const* const end = input.data() + input.size();
+#if WAVE_USE_SSE2
+            __m128i const newlines = _mm_set1_epi8('\n');
+            __m128i const returns = _mm_set1_epi8('\r');
+            __m128i const quotes = _mm_set1_epi8('"');
+            __m128i const apostrophes = _mm_set1_epi8('\'');
+            __m128i const slashes = _mm_set1_epi8('/');
+            __m128i const backslashes = _mm_set1_epi8('\\');
+
+            for (/**/; end - p >= 16; p += 16)
+            {
+                __m128i const chunk =
+                    _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+                __m128i const is_interesting = _mm_or_si128(
+                    _mm_or_si128(
+                        _mm_or_si128(_mm_cmpeq_epi8(chunk, newlines),
+                            _mm_cmpeq_epi8(chunk, returns)),
+                        _mm_or_si128(_mm_cmpeq_epi8(chunk, quotes),
+                            _mm_cmpeq_epi8(chunk, apostrophes))),
+                    _mm_or_si128(_mm_cmpeq_epi8(chunk, slashes),
+                        _mm_cmpeq_epi8(chunk, backslashes)));
+
+                if (int const mask = _mm_movemask_epi8(is_interesting);
+                    mask != 0)
+                {
+                    return (p - input.data()) +
+                        std::countr_zero(static_cast<unsigned int>(mask));
+                }
+            }
+#endif
+            while (p != end &&
+                !interesting_chars[static_cast<unsigned char>(*p)])
+            {
+                ++p;
+            }
+            return p - input.data();
+        }
+
+        // the position of the first '\n' or '\r' in [pos, end), or 'end'
+        std::size_t find_newline(
+            std::string_view input, std::size_t pos, std::size_t end) noexcept
+        {
+            char const* const first = input.data() + pos;
+            std::size_t const size = end - pos;
+
+            // a '\r' (on its own or starting a '\r\n') can only matter in
+            // front of the next '\n'
+            auto const* nl =
+                static_cast<char const*>(std::memchr(first, '\n', size));
+            std::size_t const before = nl ? nl - first : size;
+            if (auto const* cr = static_cast<char const*>(
+                    std::memchr(first, '\r', before)))
+            {
+                return cr - input.data();
+            }
+            return nl ? nl - input.data() : end;
+        }
+
+        constexpr bool is_digit(char c) noexcept
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        constexpr bool is_identifier_start(char c) noexcept
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+        }
+
+        constexpr bool is_identifier_char(char c) noexcept
+        {
+            return is_identifier_start(c) || is_digit(c);
+        }
+
+        constexpr bool is_horizontal_space(char c) noexcept
+        {
+            return c == ' ' || c == '\t' || c == '\f' || c == '\v';
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        class dependency_scanner
+        {
+        public:
+            dependency_scanner(std::string_view input,
+                std::vector<dependency_directive>& result) noexcept
+              : input(input)
+              , result(result)
+            {
+            }
+
+            void scan();
+
+        private:
+            char peek(std::size_t offset = 0) const noexcept
+            {
+                return pos + offset < input.size() ? input[pos + offset] :
+                                                     '\0';
+            }
+
+            // return the length of the newline sequence at the given position
+            std::size_t newline_length(std::size_t p) const noexcept
+            {
+                if (p >= input.size())
+                    return 0;
+                if (input[p] == '\n')
+                    return 1;
+                if (input[p] == '\r')
+                    return (p + 1 < input.size() && input[p + 1] == '\n') ? 2 :
+                                                                            1;
+                return 0;
+            }
+
+            void new_line(std::size_t length) noexcept
+            {
+                pos += length;
+                ++line;
+                line_start = pos;
+            }
+
+            void count_lines(std::size_t end) noexcept;
+
+            bool skip_splice() noexcept;
+            void skip_line_comment() noexcept;
+            void skip_block_comment() noexcept;
+            void skip_whitespace() noexcept;
+            void skip_literal(char quote) noexcept;
+            bool skip_raw_string() noexcept;
+            bool is_digit_separator() const noexcept;
+
+            std::string_view identifier() noexcept;
+            std::string_view header_name() noexcept;
+            std::string_view rest_of_line() noexcept;
+
+            bool pound() noexcept;
+            // the (1 based) line and column of a directive, these have to be
+            // taken before any line splice or comment inside of the directive
+            // is skipped
+            struct position
+            {
+                std::size_t line;
+                std::size_t column;
+            };
+
+            position current_position() const noexcept
+            {
+                return {line, pos - line_start + 1};
+            }
+
+            void directive(position const& start);
+            void module_declaration(position const& start);
+
+            void add(token_id id, std::string_view value, position const& start)
+            {
+                result.push_back(
+                    dependency_directive{id, value, start.line, start.column});
+            }
+
+            std::string_view input;
+            std::vector<dependency_directive>& result;
+
+            std::size_t pos = 0;
+            std::size_t line = 1;
+            std::size_t line_start = 0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        //  advance to 'end' while counting the newlines passed over
+        void dependency_scanner::count_lines(std::size_t end) noexcept
+        {
+            while (pos < end)
+            {
+                pos = find_newline(input, pos, end);
+                if (pos != end)
+                    new_line(newline_length(pos));
+            }
+        }
+
+        // skip a backslash followed by a newline
+        bool dependency_scanner::skip_splice() noexcept
+        {
+            std::size_t const len = newline_length(pos + 1);
+            if (len == 0)
+                return false;
+
+            ++pos;
+            new_line(len);
+            return true;
+        }
+
+        // skip to the end of a '//' comment, the newline is not consumed
+        void dependency_scanner::skip_line_comment() noexcept
+        {
+            while (pos < input.size())
+            {
+                pos = find_newline(input, pos, input.size());
+                if (pos == input.size() || input[pos - 1] != '\\')
+                    return;
+
+                // the comment continues on the next line
+                new_line(newline_length(pos));
+            }
+        }
+
+        void dependency_scanner::skip_block_comment() noexcept
+        {
+            std::size_t const p = input.find("*/", pos);
+            count_lines(p == std::string_view::npos ? input.size() : p);
+            if (p != std::string_view::npos)
+                pos += 2;
+        }
+
+        // skip horizontal white space, comments and line splices
+        void dependency_scanner::skip_whitespace() noexcept
+        {
+            while (pos < input.size())
+            {
+                char const c = input[pos];
+                if (is_horizontal_space(c))
+                {
+                    ++pos;
+                }
+                else if (c == '\\')
+                {
+                    if (!skip_splice())
+                        return;
+                }
+                else if (c == '/' && peek(1) == '*')
+                {
+                    pos += 2;
+                    skip_block_comment();
+                }
+                else if (c == '/' && peek(1) == '/')
+                {
+                    pos += 2;
+                    skip_line_comment();
+                }
+                else
+                {
+                    return;
+                }
+            }
+        }
+
+        // skip a string or character literal, an unterminated literal ends at
+        // the end of the line
+        void dependency_scanner::skip_literal(char quote) noexcept
+        {
+            ++pos;
+            while (pos < input.size())
+            {
+                char const c = input[pos];
+                if (c == quote)
+                {
+                    ++pos;
+                    return;
+                }
+
+                if (c == '\n' || c == '\r')
+                    return;
+
+                if (c == '\\')
+                {
+                    if (!skip_splice())
+                        pos += 2;
+                }
+                else
+                {
+                    ++pos;
+                }
+            }
+            pos = input.size();
+        }
+
+        // skip a raw string literal, 'pos' refers to the opening quote
+        bool dependency_scanner::skip_raw_string() noexcept
+        {
+            // the quote has to be preceded by one of the prefixes R, u8R,
+            // uR, UR, or LR which itself is not part of an identifier
+            if (pos == 0 || input[pos - 1] != 'R')
+                return false;
+
+            auto const prefix_starts_at = [&](std::size_t start) {
+                return start == 0 || !is_identifier_char(input[start - 1]);
+            };
+
+            std::size_t const r = pos - 1;
+            if (!prefix_starts_at(r) &&
+                !(r >= 1 &&
+                    (input[r - 1] == 'u' || input[r - 1] == 'U' ||
+                        input[r - 1] == 'L') &&
+                    prefix_starts_at(r - 1)) &&
+                !(r >= 2 && input[r - 2] == 'u' && input[r - 1] == '8' &&
+                    prefix_starts_at(r - 2)))
+            {
+                return false;
+            }
+
+            // the delimiter consists of at most 16 characters
+            std::size_t const delim_start = pos + 1;
+            std::size_t p = delim_start;
+            while (p < input.size() && p - delim_start <= 16)
+            {
+                char const c = input[p];
+                if (c == '(' || c == ')' || c == '\\' || c == '"' ||
+                    is_horizontal_space(c) || c == '\n' || c == '\r')
+                {
+                    break;
+                }
+                ++p;
+            }
+            if (p >= input.size() || input[p] != '(' || p - delim_start > 16)
+                return false;
+
+            // find ')delim"', no line splicing takes place inside of raw
+            // string literals
+            char closing[19];
+            std::size_t const delim_length = p - delim_start;
+            closing[0] = ')';
+            input.copy(closing + 1, delim_length, delim_start);
+            closing[delim_length + 1] = '"';
+            std::string_view const close(closing, delim_length + 2);
+
+            std::size_t const end = input.find(close, p + 1);
+            if (end == std::string_view::npos)
+            {
+                count_lines(input.size());
+                return true;
+            }
+
+            count_lines(end);
+            pos += close.size();
+            return true;
+        }
+
+        // a single quote is a digit separator if it is part of a pp-number
+        bool dependency_scanner::is_digit_separator() const noexcept
+        {
+            std::size_t start = pos;
+            while (start != 0)
+            {
+                char const c = input[start - 1];
+                if (is_identifier_char(c) || c == '.' || c == '\'')
+                {
+                    --start;
+                }
+                else if ((c == '+' || c == '-') && start >= 2 &&
+                    (input[start - 2] == 'e' || input[start - 2] == 'E' ||
+                        input[start - 2] == 'p' || input[start - 2] == 'P'))
+                {
+                    --start;
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            return start != pos &&
+                (is_digit(input[start]) ||
+                    (input[start] == '.' && is_digit(input[start + 1])));
+        }
+
+        std::string_view dependency_scanner::identifier() noexcept
+        {
+            std::size_t const start = pos;
+            if (pos < input.size() && is_identifier_start(input[pos]))
+            {
+                ++pos;
+                while (pos < input.size() && is_identifier_char(input[pos]))
+                    ++pos;
+            }
+            return input.substr(start, pos - start);
+        }
+
+        // return a '<...>' or '"..."' header name (including the delimiters),
+        // or an empty string if the name is not closed on the same line
+        std::string_view dependency_scanner::header_name() noexcept
+        {
+            char const closing = input[pos] == '<' ? '>' : '"';
+            for (std::size_t p = pos + 1; p < input.size(); ++p)
+            {
+                char const c = input[p];
+                if (c == closing)
+                {
+                    std::string_view const name =
+                        input.substr(pos, p + 1 - pos);
+                    pos = p + 1;
+                    return name;
+                }
+                if (c == '\n' || c == '\r')
+                    break;
+            }
+            return {};
+        }
+
+        // return the remaining text up to the end of the line (or to the
+        // start of a comment), trailing white space is not included
+        std::string_view dependency_scanner::rest_of_line() noexcept
+        {
+            std::size_t const start = pos;
+            while (pos < input.size())
+            {
+                char const c = input[pos];
+                if (c == '\n' || c == '\r' ||
+                    (c == '/' && (peek(1) == '/' || peek(1) == '*')))
+                {
+                    break;
+                }
+                ++pos;
+            }
+
+            std::size_t end = pos;
+            while (end != start && is_horizontal_space(input[end - 1]))
+                --end;
+            return input.substr(start, end - start);
+        }
+
+        // recognize '#', '%:', and '??='
+        bool dependency_scanner::pound() noexcept
+        {
+            char const c = peek();
+            if (c == '#')
+            {
+                pos += 1;
+                return true;
+            }
+            if (c == '%' && peek(1) == ':')
+            {
+                pos += 2;
+                return true;
+            }
+            if (c == '?' && peek(1) == '?' && peek(2) == '=')
+            {
+                pos += 3;
+                return true;
+            }
+            return false;
+        }
+
+        void dependency_scanner::directive(position const& start)
+        {
+            skip_whitespace();
+
+            std::string_view const name = identifier();
+            std::uint32_t alt = 0;
+            if (name != "include")
+            {
+#if WAVE_SUPPORT_INCLUDE_NEXT != 0
+                if (name != "include_next")
+                    return;
+                alt = AltTokenType;
+#else
+                return;
+#endif
+            }
+
+            skip_whitespace();
+
+            char const c = peek();
+            if (c == '<' || c == '"')
+            {
+                std::string_view const value = header_name();
+                if (!value.empty())
+                {
+                    add(static_cast<token_id>(
+                            (c == '<' ? T_PP_HHEADER : T_PP_QHEADER) | alt),
+                        value, start);
+                    return;
+                }
+            }
+            add(static_cast<token_id>(T_PP_INCLUDE | alt), rest_of_line(),
+                start);
+        }
+
+        // recognize [export] module ...; and [export] import ...;
+        void dependency_scanner::module_declaration(
+            position const& start)
+        {
+            std::string_view name = identifier();
+            if (name == "export")
+            {
+                skip_whitespace();
+                name = identifier();
+            }
+
+            token_id id;
+            if (name == "module")
+                id = T_MODULE;
+            else if (name == "import")
+                id = T_IMPORT;
+            else
+                return;
+
+            // 'module' and 'import' are keywords only if followed by one of
+            // the tokens allowed in a module declaration
+            skip_whitespace();
+
+            char const c = peek();
+            bool const is_declaration = is_identifier_start(c) ||
+                (c == ':' && peek(1) != ':') ||
+                (id == T_MODULE ? c == ';' : (c == '<' || c == '"'));
+            if (!is_declaration)
+                return;
+
+            std::string_view value;
+            if (id == T_IMPORT && (c == '<' || c == '"'))
+            {
+                value = header_name();
+            }
+            else
+            {
+                std::size_t const value_start = pos;
+                std::size_t end = pos;
+                while (pos < input.size())
+                {
+                    char const ch = input[pos];
+                    if (ch == ';' || ch == '[' || ch == '\n' || ch == '\r')
+                        break;
+                    if (!is_horizontal_space(ch))
+                        end = pos + 1;
+                    ++pos;
+                }
+                value = input.substr(value_start, end - value_start);
+            }
+            add(id, value, start);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void dependency_scanner::scan()
+        {
+            bool at_line_start = true;
+            while (pos < input.size())
+            {
+                if (at_line_start)
+                {
+                    at_line_start = false;
+
+                    skip_whitespace();
+
+                    position const start = current_position();
+                    if (pound())
+                        directive(start);
+                    else if (char const c = peek();
+                             c == 'e' || c == 'i' || c == 'm')
+                    {
+                        // 'export', 'import', or 'module'
+                        module_declaration(start);
+                    }
+                    continue;
+                }
+
+                // skip everything which can't start a comment, a literal,
+                // a line splice, or a new line
+                pos = find_interesting(input, pos);
+                if (pos == input.size())
+                    break;
+
+                switch (input[pos])
+                {
+                case '\n':
+                case '\r':
+                    new_line(newline_length(pos));
+                    at_line_start = true;
+                    break;
+
+                case '"':
+                    if (!skip_raw_string())
+                        skip_literal('"');
+                    break;
+
+                case '\'':
+                    if (is_digit_separator())
+                        ++pos;
+                    else
+                        skip_literal('\'');
+                    break;
+
+                case '/':
+                    if (peek(1) == '/')
+                    {
+                        pos += 2;
+                        skip_line_comment();
+                    }
+                    else if (peek(1) == '*')
+                    {
+                        pos += 2;
+                        skip_block_comment();
+                    }
+                    else
+                    {
+                        ++pos;
+                    }
+                    break;
+
+                case '\\':
+                    if (!skip_splice())
+                        ++pos;
+                    break;
+
+                default:
+                    break;
+                }
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void scan_dependencies(
+        std::string_view input, std::vector<dependency_directive>& result)
+    {
+        dependency_scanner(input, result).scan();
+    }
+}    // namespace wave::cpplexer
@@ -0,0 +1,67 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+#include "token_ids.hpp"
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  dependency_directive
+    //
+    //      A single dependency related directive found by scan_dependencies().
+    //      The id is one of:
+    //
+    //          T_PP_HHEADER    #include <file>, value is "<file>"
+    //          T_PP_QHEADER    #include "file", value is "\"file\""
+    //          T_PP_INCLUDE    #include MACRO, value is the remaining text of
+    //                          the directive line ("MACRO")
+    //          T_IMPORT        [export] import name;, value is the name, the
+    //                          partition (":part") or the header name
+    //          T_MODULE        [export] module name;, value is the module name
+    //                          (empty for the global module fragment)
+    //
+    //      The #include_next variants are reported with the AltTokenType bit
+    //      set (as the lexer does). The value refers to the scanned input, line
+    //      and column denote the (1 based) position of the first character of
+    //      the directive.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    struct dependency_directive
+    {
+        token_id id;
+        std::string_view value;
+        std::size_t line;
+        std::size_t column;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  scan_dependencies
+    //
+    //      Find all #include directives and C++20 module/import declarations
+    //      in the given input without tokenizing it. Everything else is only
+    //      skipped over: the scanner looks at the bytes which could start a
+    //      comment, a string or character literal, a line splice or a new
+    //      line, all other characters are passed over 16 at a time (using
+    //      SSE2, if available). The text of comments is skipped using memchr.
+    //
+    //      Conditional compilation is not evaluated, all directives found in
+    //      the input are reported in order of appearance (appended to 'result').
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    void scan_dependencies(
+        std::string_view input, std::vector<dependency_directive>& result);
+
+}    // namespace wave::cpplexer
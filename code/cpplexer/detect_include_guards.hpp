@@ -0,0 +1,323 @@
+/*=============================================================================
+    Boost.Wave: A Standard compliant C++ preprocessor library
+
+    State machine detecting include guards in an included file.
+    This detects two forms of include guards:
+
+        #ifndef INCLUDE_GUARD_MACRO
+        #define INCLUDE_GUARD_MACRO
+        ...
+        #endif
+
+    or
+
+        #if !defined(INCLUDE_GUARD_MACRO)
+        #define INCLUDE_GUARD_MACRO
+        ...
+        #endif
+
+    note, that the parenthesis are optional (i.e. !defined INCLUDE_GUARD_MACRO
+    will work as well). The code allows for any whitespace, newline and single
+    '#' tokens before the #if/#ifndef and after the final #endif.
+
+    Additionally a '#pragma once' directive outside of any conditional block
+    is detected.
+
+    http://www.boost.org/
+
+    Copyright (c) 2001-2012 Hartmut Kaiser. Distributed under the Boost
+    Software License, Version 1.0. (See accompanying file
+    LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#pragma once
+
+#include "config.hpp"
+#include "token_ids.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  include_guards
+    //
+    //      The detection is done while the lexer returns the tokens of a file:
+    //      an include_guards instance attached to a lexer (see
+    //      lex_iterator::set_include_guards) sees all tokens as they are
+    //      produced, the result is available after the end of the file was
+    //      reached.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename Token>
+    class include_guards
+    {
+    public:
+        using string_type = typename Token::string_type;
+
+        include_guards() = default;
+
+        Token& detect_guard(Token& t)
+        {
+            detect_pragma_once(t);
+            return current_state ? (this->*state)(t) : t;
+        }
+
+        // returns true, if the file is guarded by an include guard macro (the
+        // name of which is returned in guard_name) or by '#pragma once' (in
+        // which case guard_name is cleared). A '#pragma once' is taken into
+        // account only if it is not inside of any conditional block (even
+        // one which is always enabled), a file having an #else or #elif
+        // belonging to the guarding #if is not considered to be guarded.
+        bool detected(string_type& guard_name_) const
+        {
+            if (detected_guards)
+            {
+                guard_name_ = guard_name;
+                return true;
+            }
+            if (pragma_once)
+            {
+                guard_name_.clear();
+                return true;
+            }
+            return false;
+        }
+
+        bool has_pragma_once() const noexcept
+        {
+            return pragma_once;
+        }
+
+    private:
+        using state_type = Token&(Token& t);
+        state_type include_guards::*state = &include_guards::state_0;
+
+        bool detected_guards = false;
+        bool current_state = true;
+        string_type guard_name;
+        int if_depth = 0;
+
+        bool pragma_once = false;
+        bool after_pragma = false;
+        int pragma_if_depth = 0;    // nesting of conditionals at the #pragma
+
+        state_type state_0, state_1, state_2, state_3, state_4, state_5;
+        state_type state_1a, state_1b, state_1c, state_1d, state_1e;
+
+        void detect_pragma_once(Token const& t);
+
+        static bool is_skippable(token_id id) noexcept
+        {
+            return T_POUND == BASE_TOKEN(id) ||
+                IS_CATEGORY(id, WhiteSpaceTokenType) ||
+                IS_CATEGORY(id, EOLTokenType);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  state 0: beginning of a file, tries to recognize #ifndef or #if tokens
+    template <typename Token>
+    inline Token& include_guards<Token>::state_0(Token& t)
+    {
+        token_id const id = token_id(t);
+        if (T_PP_IFNDEF == id)
+            state = &include_guards::state_1;
+        else if (T_PP_IF == id)
+            state = &include_guards::state_1a;
+        else if (!is_skippable(id))
+            current_state = false;
+        return t;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  state 1: found #ifndef, looking for T_IDENTIFIER
+    template <typename Token>
+    inline Token& include_guards<Token>::state_1(Token& t)
+    {
+        token_id const id = token_id(t);
+        if (T_IDENTIFIER == id)
+        {
+            guard_name = t.get_value();
+            state = &include_guards::state_2;
+        }
+        else if (!is_skippable(id))
+        {
+            current_state = false;
+        }
+        return t;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  state 1a: found T_PP_IF, looking for T_NOT ("!")
+    template <typename Token>
+    inline Token& include_guards<Token>::state_1a(Token& t)
+    {
+        token_id const id = token_id(t);
+        if (T_NOT == BASE_TOKEN(id))
+            state = &include_guards::state_1b;
+        else if (!is_skippable(id))
+            current_state = false;
+        return t;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  state 1b: found T_NOT, looking for 'defined'
+    template <typename Token>
+    inline Token& include_guards<Token>::state_1b(Token& t)
+    {
+        token_id const id = token_id(t);
+        if (T_IDENTIFIER == id && t.get_value() == "defined")
+            state = &include_guards::state_1c;
+        else if (!is_skippable(id))
+            current_state = false;
+        return t;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  state 1c: found 'defined', looking for (optional) T_LEFTPAREN
+    template <typename Token>
+    inline Token& include_guards<Token>::state_1c(Token& t)
+    {
+        token_id const id = token_id(t);
+        if (T_LEFTPAREN == id)
+        {
+            state = &include_guards::state_1d;
+        }
+        else if (T_IDENTIFIER == id)
+        {
+            guard_name = t.get_value();
+            state = &include_guards::state_2;
+        }
+        else if (!is_skippable(id))
+        {
+            current_state = false;
+        }
+        return t;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  state 1d: found T_LEFTPAREN, looking for T_IDENTIFIER guard
+    template <typename Token>
+    inline Token& include_guards<Token>::state_1d(Token& t)
+    {
+        token_id const id = token_id(t);
+        if (T_IDENTIFIER == id)
+        {
+            guard_name = t.get_value();
+            state = &include_guards::state_1e;
+        }
+        else if (!is_skippable(id))
+        {
+            current_state = false;
+        }
+        return t;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  state 1e: found T_IDENTIFIER guard, looking for T_RIGHTPAREN
+    template <typename Token>
+    inline Token& include_guards<Token>::state_1e(Token& t)
+    {
+        token_id const id = token_id(t);
+        if (T_RIGHTPAREN == id)
+            state = &include_guards::state_2;
+        else if (!is_skippable(id))
+            current_state = false;
+        return t;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  state 2: found T_IDENTIFIER, looking for #define
+    template <typename Token>
+    inline Token& include_guards<Token>::state_2(Token& t)
+    {
+        token_id const id = token_id(t);
+        if (T_PP_DEFINE == id)
+            state = &include_guards::state_3;
+        else if (!is_skippable(id))
+            current_state = false;
+        return t;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  state 3: found #define, looking for T_IDENTIFIER as recognized by state 1
+    template <typename Token>
+    inline Token& include_guards<Token>::state_3(Token& t)
+    {
+        token_id const id = token_id(t);
+        if (T_IDENTIFIER == id && t.get_value() == guard_name)
+            state = &include_guards::state_4;
+        else if (!is_skippable(id))
+            current_state = false;
+        return t;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  state 4: found guard T_IDENTIFIER, looking for #endif
+    template <typename Token>
+    inline Token& include_guards<Token>::state_4(Token& t)
+    {
+        token_id const id = token_id(t);
+        if (T_PP_IF == id || T_PP_IFDEF == id || T_PP_IFNDEF == id)
+        {
+            ++if_depth;
+        }
+        else if (T_PP_ENDIF == id)
+        {
+            if (if_depth > 0)
+                --if_depth;
+            else
+                state = &include_guards::state_5;
+        }
+        else if ((T_PP_ELSE == id || T_PP_ELIF == id) && if_depth == 0)
+        {
+            // the rest of the file is used if the guard is defined already
+            current_state = false;
+        }
+        return t;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  state 5: found final #endif, looking for T_EOF
+    template <typename Token>
+    inline Token& include_guards<Token>::state_5(Token& t)
+    {
+        token_id const id = token_id(t);
+        if (T_EOF == id)
+            detected_guards = current_state;
+        else if (!is_skippable(id))
+            current_state = false;
+        return t;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  '#pragma once' is recognized independently of the include guard states,
+    //  but only outside of conditional blocks
+    template <typename Token>
+    inline void include_guards<Token>::detect_pragma_once(Token const& t)
+    {
+        token_id const id = token_id(t);
+        if (T_PP_IF == id || T_PP_IFDEF == id || T_PP_IFNDEF == id)
+        {
+            ++pragma_if_depth;
+        }
+        else if (T_PP_ENDIF == id)
+        {
+            if (pragma_if_depth > 0)
+                --pragma_if_depth;
+        }
+        else if (T_PP_PRAGMA == id)
+        {
+            after_pragma = pragma_if_depth == 0;
+        }
+        else if (after_pragma && !IS_CATEGORY(id, WhiteSpaceTokenType))
+        {
+            after_pragma = false;
+            if (T_IDENTIFIER == id && t.get_value() == "once")
+                pragma_once = true;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
@@ -0,0 +1,566 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "directory_lexer.hpp"
+#include "bounded_queue.hpp"
+#include "file_position.hpp"
+#include "stream_input.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    namespace {
+
+        using clock_type = std::chrono::steady_clock;
+
+        struct source_file
+        {
+            std::filesystem::path path;
+            std::size_t size;
+        };
+
+        std::vector<source_file> find_sources(
+            std::filesystem::path const& directory,
+            std::vector<std::string> const& extensions)
+        {
+            std::vector<source_file> files;
+            for (auto const& entry :
+                std::filesystem::recursive_directory_iterator(directory,
+                    std::filesystem::directory_options::skip_permission_denied))
+            {
+                std::error_code ec;
+                if (!entry.is_regular_file(ec))
+                    continue;
+
+                std::string const extension = entry.path().extension().string();
+                if (std::find(extensions.begin(), extensions.end(),
+                        extension) == extensions.end())
+                {
+                    continue;
+                }
+
+                std::size_t const size = entry.file_size(ec);
+                files.push_back(source_file{entry.path(), ec ? 0 : size});
+            }
+
+            // hand out the largest files first, this keeps all workers busy
+            // until the end
+            std::stable_sort(files.begin(), files.end(),
+                [](source_file const& lhs, source_file const& rhs) {
+                    return lhs.size > rhs.size;
+                });
+            return files;
+        }
+
+        // the scanner reads the file in chunks directly into the buffer the
+        // token values refer to
+        void lex_file(std::filesystem::path const& path,
+            language_support language, token_soa_buffer& result)
+        {
+            std::ifstream instream(path, std::ios::binary);
+            if (!instream.is_open())
+            {
+                throw std::runtime_error(
+                    "Could not open input file: " + path.string());
+            }
+
+            istream_input input(instream);
+            token_soa_gen<stream_input_ref>::lex(stream_input_ref(input),
+                stream_input_ref(), wave::util::file_position_type(path.string()),
+                language, result);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        //  limits the accumulated size of the files being processed
+        class in_flight_limit
+        {
+        public:
+            explicit in_flight_limit(std::size_t max_bytes_)
+              : max_bytes(max_bytes_)
+            {
+            }
+
+            // returns false (without acquiring the bytes) once the limit
+            // was closed
+            bool acquire(std::size_t bytes)
+            {
+                std::unique_lock<std::mutex> l(mtx);
+                cond.wait(l, [&] {
+                    return closed || in_flight == 0 ||
+                        in_flight + bytes <= max_bytes;
+                });
+                if (closed)
+                    return false;
+                in_flight += bytes;
+                return true;
+            }
+
+            void release(std::size_t bytes)
+            {
+                {
+                    std::lock_guard<std::mutex> l(mtx);
+                    in_flight -= bytes;
+                }
+                cond.notify_all();
+            }
+
+            // wake all waiting threads
+            void close()
+            {
+                {
+                    std::lock_guard<std::mutex> l(mtx);
+                    closed = true;
+                }
+                cond.notify_all();
+            }
+
+        private:
+            std::mutex mtx;
+            std::condition_variable cond;
+            std::size_t const max_bytes;
+            std::size_t in_flight = 0;
+            bool closed = false;
+        };
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    double directory_lexer_stats::files_per_second() const noexcept
+    {
+        return seconds > 0 ? files / seconds : 0.0;
+    }
+
+    double directory_lexer_stats::megabytes_per_second() const noexcept
+    {
+        return seconds > 0 ? bytes / (1024.0 * 1024.0) / seconds : 0.0;
+    }
+
+    double directory_lexer_stats::tokens_per_second() const noexcept
+    {
+        return seconds > 0 ? tokens / seconds : 0.0;
+    }
+
+    double directory_lexer_stats::utilization(
+        std::size_t worker) const noexcept
+    {
+        return seconds > 0 && worker < busy_seconds.size() ?
+            busy_seconds[worker] / seconds :
+            0.0;
+    }
+
+    std::ostream& operator<<(
+        std::ostream& os, directory_lexer_stats const& stats)
+    {
+        os << stats.files << " files (" << stats.failed_files << " failed), "
+           << stats.bytes << " bytes, " << stats.tokens << " tokens in "
+           << stats.seconds << " s\n"
+           << stats.files_per_second() << " files/s, "
+           << stats.megabytes_per_second() << " MB/s, "
+           << stats.tokens_per_second() << " tokens/s\n";
+        for (std::size_t i = 0; i != stats.busy_seconds.size(); ++i)
+        {
+            os << "worker " << i << ": " << stats.busy_seconds[i] << " s busy, "
+               << 100.0 * stats.utilization(i) << "% utilization\n";
+        }
+        if (stats.reader_busy_seconds > 0)
+            os << "reader: " << stats.reader_busy_seconds << " s busy\n";
+        for (std::size_t i = 0; i != stats.consumer_busy_seconds.size(); ++i)
+        {
+            os << "consumer " << i << ": " << stats.consumer_busy_seconds[i]
+               << " s busy\n";
+        }
+        return os;
+    }
+
+
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        //  the state shared by the threads of a tokenize_directory() run
+        struct directory_run
+        {
+            directory_run(std::vector<source_file> const& files_,
+                directory_sink& sink_, directory_lexer_options const& options_)
+              : files(files_)
+              , sink(sink_)
+              , options(options_)
+              , limit(options_.max_in_flight_bytes)
+            {
+            }
+
+            // pass the tokens of the lexed file to the sink, an exception
+            // thrown by the sink is reported to its failed() function (and
+            // the file is not counted as consumed)
+            void consume(std::size_t worker, source_file const& file,
+                token_soa_buffer const& result) noexcept
+            {
+                try
+                {
+                    sink.consume(worker, file.path, result);
+                    bytes += file.size;
+                    tokens += result.size();
+                }
+                catch (...)
+                {
+                    failed(worker, file, std::current_exception());
+                }
+            }
+
+            // an exception thrown by the sink is dropped, it would escape
+            // from the thread otherwise
+            void failed(std::size_t worker, source_file const& file,
+                std::exception_ptr error) noexcept
+            {
+                ++failed_files;
+                try
+                {
+                    sink.failed(worker, file.path, error);
+                }
+                catch (...)
+                {
+                }
+            }
+
+            std::vector<source_file> const& files;
+            directory_sink& sink;
+            directory_lexer_options const& options;
+
+            in_flight_limit limit;
+            std::atomic<std::size_t> failed_files{0};
+            std::atomic<std::size_t> bytes{0};
+            std::atomic<std::size_t> tokens{0};
+        };
+
+        // join the given threads, even if an exception is thrown
+        struct join_threads
+        {
+            ~join_threads()
+            {
+                for (auto& t : pool)
+                {
+                    if (t.joinable())
+                        t.join();
+                }
+            }
+
+            std::vector<std::thread>& pool;
+        };
+
+        // run the given function on 'count' threads, passing the index of
+        // the thread, the first one runs on the calling thread. If a thread
+        // can't be started, stop() is called to make the running ones return
+        // before the exception is rethrown.
+        template <typename F, typename Stop>
+        void run_threads(std::size_t count, F&& f, Stop&& stop)
+        {
+            std::vector<std::thread> pool;
+            join_threads joiner{pool};
+
+            try
+            {
+                pool.reserve(count - 1);
+                for (std::size_t i = 1; i < count; ++i)
+                    pool.emplace_back(f, i);
+            }
+            catch (...)
+            {
+                stop();
+                throw;
+            }
+            f(0);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        //  each worker reads, lexes and consumes a file before taking the
+        //  next one
+        void lex_files(directory_run& run, std::size_t threads,
+            directory_lexer_stats& stats)
+        {
+            stats.busy_seconds.resize(threads);
+
+            std::atomic<std::size_t> next_file(0);
+            auto const stop = [&]() noexcept {
+                next_file = run.files.size();
+            };
+
+            run_threads(threads, [&](std::size_t index) {
+                token_soa_buffer result;
+                clock_type::duration busy{};
+
+                for (std::size_t i = next_file++; i < run.files.size();
+                     i = next_file++)
+                {
+                    source_file const& file = run.files[i];
+
+                    if (!run.limit.acquire(file.size))
+                        break;
+                    auto const started = clock_type::now();
+                    bool lexed = false;
+                    try
+                    {
+                        lex_file(file.path, run.options.language, result);
+                        lexed = true;
+                    }
+                    catch (...)
+                    {
+                        run.failed(index, file, std::current_exception());
+                    }
+                    if (lexed)
+                        run.consume(index, file, result);
+                    result.clear();
+                    busy += clock_type::now() - started;
+                    run.limit.release(file.size);
+                }
+
+                stats.busy_seconds[index] =
+                    std::chrono::duration<double>(busy).count();
+            }, stop);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        //  the items passed between the stages of a pipelined run, every
+        //  file passes all stages (carrying the error if a stage failed)
+        struct read_file_item
+        {
+            std::size_t file = 0;
+            std::string contents;
+            std::exception_ptr error;
+        };
+
+        struct lexed_file_item
+        {
+            std::size_t file = 0;
+            token_soa_buffer* tokens = nullptr;
+            std::exception_ptr error;
+        };
+
+        // the number of stage threads to use
+        std::size_t stage_threads(std::size_t threads, std::size_t files)
+        {
+            return (std::max)(
+                (std::min)(threads, files), static_cast<std::size_t>(1));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        //  the reader thread reads the files into memory, the workers lex
+        //  them and the consumer threads pass the tokens to the sink
+        void lex_files_pipelined(directory_run& run, std::size_t threads,
+            directory_lexer_stats& stats)
+        {
+            std::size_t const count = run.files.size();
+            std::size_t const consumers =
+                stage_threads(run.options.consumer_threads, count);
+
+            stats.busy_seconds.resize(threads);
+            stats.consumer_busy_seconds.resize(consumers);
+
+            detail::bounded_queue<read_file_item> read_files(
+                run.options.queue_capacity);
+            detail::bounded_queue<lexed_file_item> lexed_files(
+                run.options.queue_capacity);
+
+            // the token arrays are handed back to the workers once consumed,
+            // there are never more of them in use than one per worker and
+            // consumer plus the ones waiting in between
+            std::size_t const buffer_count =
+                threads + consumers + lexed_files.max_size();
+            std::vector<std::unique_ptr<token_soa_buffer>> buffers(
+                buffer_count);
+            detail::bounded_queue<token_soa_buffer*> free_buffers(
+                buffer_count);
+            for (auto& buffer : buffers)
+            {
+                buffer = std::make_unique<token_soa_buffer>();
+                free_buffers.push(buffer.get());
+            }
+
+            // each worker and consumer thread claims one of the files before
+            // taking the next item from its queue, this way all threads of a
+            // stage know when to stop without having to close the queues
+            std::atomic<std::size_t> next_lexed(0);
+            std::atomic<std::size_t> next_consumed(0);
+
+            // the queues are closed only if one of the threads can't be
+            // started, the others would wait for its items forever
+            auto const stop = [&]() {
+                run.limit.close();
+                read_files.close();
+                lexed_files.close();
+                free_buffers.close();
+            };
+
+            // the files are read ahead in the order they are lexed
+            std::vector<std::filesystem::path> paths;
+            paths.reserve(count);
+            for (source_file const& file : run.files)
+                paths.push_back(file.path);
+            file_prefetcher prefetcher(std::move(paths), run.options.prefetch);
+
+            auto reader = [&]() {
+                clock_type::duration busy{};
+                std::exception_ptr error;    // the prefetcher has failed
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    if (!run.limit.acquire(run.files[i].size))
+                        break;
+                    auto const started = clock_type::now();
+
+                    prefetched_file file;
+                    if (!error)
+                    {
+                        try
+                        {
+                            prefetcher.next(file);
+                        }
+                        catch (...)
+                        {
+                            error = std::current_exception();
+                        }
+                    }
+                    busy += clock_type::now() - started;
+
+                    if (!read_files.push(read_file_item{i,
+                            std::move(file.contents),
+                            error ? error : file.error}))
+                    {
+                        break;
+                    }
+                }
+                stats.reader_busy_seconds =
+                    std::chrono::duration<double>(busy).count();
+            };
+
+            auto worker = [&](std::size_t index) {
+                clock_type::duration busy{};
+                while (next_lexed++ < count)
+                {
+                    read_file_item item;
+                    token_soa_buffer* tokens = nullptr;
+                    if (!read_files.pop(item) || !free_buffers.pop(tokens))
+                        break;
+
+                    auto const started = clock_type::now();
+                    if (!item.error)
+                    {
+                        try
+                        {
+                            std::string const& contents = item.contents;
+                            token_soa_gen<std::string::const_iterator>::lex(
+                                contents.begin(), contents.end(),
+                                wave::util::file_position_type(
+                                    run.files[item.file].path.string()),
+                                run.options.language, *tokens);
+                        }
+                        catch (...)
+                        {
+                            item.error = std::current_exception();
+                        }
+                    }
+                    item.contents = std::string();
+                    busy += clock_type::now() - started;
+
+                    if (!lexed_files.push(
+                            lexed_file_item{item.file, tokens, item.error}))
+                    {
+                        break;
+                    }
+                }
+                stats.busy_seconds[index] =
+                    std::chrono::duration<double>(busy).count();
+            };
+
+            // the sink's exceptions are handled by directory_run, nothing may
+            // escape from a consumer while the other stages wait for it
+            auto consumer = [&](std::size_t index) noexcept {
+                clock_type::duration busy{};
+                while (next_consumed++ < count)
+                {
+                    lexed_file_item item;
+                    if (!lexed_files.pop(item))
+                        break;
+                    source_file const& file = run.files[item.file];
+
+                    auto const started = clock_type::now();
+                    if (item.error)
+                        run.failed(index, file, item.error);
+                    else
+                        run.consume(index, file, *item.tokens);
+                    item.tokens->clear();
+                    busy += clock_type::now() - started;
+
+                    free_buffers.push(item.tokens);
+                    run.limit.release(file.size);
+                }
+                stats.consumer_busy_seconds[index] =
+                    std::chrono::duration<double>(busy).count();
+            };
+
+            std::vector<std::thread> pool;
+            join_threads joiner{pool};
+
+            try
+            {
+                pool.reserve(consumers + 1);
+                pool.emplace_back(reader);
+                for (std::size_t i = 0; i != consumers; ++i)
+                    pool.emplace_back(consumer, i);
+            }
+            catch (...)
+            {
+                stop();
+                throw;
+            }
+            run_threads(threads, worker, stop);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    directory_lexer_stats tokenize_directory(
+        std::filesystem::path const& directory, directory_sink& sink,
+        directory_lexer_options const& options)
+    {
+        auto const start = clock_type::now();
+
+        std::vector<source_file> const files =
+            find_sources(directory, options.extensions);
+
+        std::size_t threads = options.threads;
+        if (threads == 0)
+            threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+        threads = stage_threads(threads, files.size());
+
+        directory_lexer_stats stats;
+        directory_run run(files, sink, options);
+        if (options.pipelined)
+            lex_files_pipelined(run, threads, stats);
+        else
+            lex_files(run, threads, stats);
+
+        stats.files = files.size();
+        stats.failed_files = run.failed_files;
+        stats.bytes = run.bytes;
+        stats.tokens = run.tokens;
+        stats.seconds =
+            std::chrono::duration<double>(clock_type::now() - start).count();
+        return stats;
+    }
+}    // namespace wave::cpplexer
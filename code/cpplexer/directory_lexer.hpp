@@ -0,0 +1,156 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+#include "file_prefetcher.hpp"
+#include "language_support.hpp"
+#include "token_soa_buffer.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  directory_sink
+    //
+    //      Receives the tokens of the files lexed by tokenize_directory().
+    //      The functions are called concurrently from the worker threads (or
+    //      the consumer threads of a pipelined run), 'worker' is the index
+    //      of the calling thread (in the range [0, number of threads)), which
+    //      allows to keep per thread state without locking. The tokens refer
+    //      to a buffer owned by the lexer, they are valid only during the
+    //      call.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    class directory_sink
+    {
+    public:
+        virtual ~directory_sink() = default;
+
+        virtual void consume(std::size_t worker,
+            std::filesystem::path const& file,
+            token_soa_buffer const& tokens) = 0;
+
+        // a file could not be read or lexed (or consume() has thrown), the
+        // remaining files are lexed nevertheless. Exceptions thrown by this
+        // function are ignored.
+        virtual void failed(std::size_t /* worker */,
+            std::filesystem::path const& /* file */,
+            std::exception_ptr /* error */)
+        {
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    struct directory_lexer_options
+    {
+        // the file name extensions of the files to lex (compared case
+        // sensitively, including the leading '.')
+        std::vector<std::string> extensions = {".c", ".cc", ".cpp", ".cxx",
+            ".c++", ".h", ".hh", ".hpp", ".hxx", ".h++", ".inl", ".ipp",
+            ".ixx", ".cppm"};
+
+        // the number of worker threads, 0 uses one thread per core
+        std::size_t threads = 0;
+
+        // read, lex and consume the files on different threads: the files
+        // read ahead by a reader thread are lexed by the worker threads and
+        // are passed to the sink by the consumer threads. Otherwise each
+        // file is read, lexed and consumed by a single worker thread.
+        bool pipelined = false;
+
+        // how the reader thread of a pipelined run reads the files ahead
+        file_prefetch_options prefetch;
+
+        // the number of threads calling the sink in a pipelined run (at
+        // least one)
+        std::size_t consumer_threads = 1;
+
+        // the number of files which may wait between two stages of a
+        // pipelined run (rounded up to a power of two)
+        std::size_t queue_capacity = 16;
+
+        // the maximal accumulated size of the files being read and lexed at
+        // the same time, a single larger file is lexed on its own
+        std::size_t max_in_flight_bytes = std::size_t(256) * 1024 * 1024;
+
+        language_support language = language_support(support_cpp |
+            support_cpp20 | support_option_long_long);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  throughput statistics of a tokenize_directory() run
+    struct directory_lexer_stats
+    {
+        std::size_t files = 0;
+        std::size_t failed_files = 0;
+        std::size_t bytes = 0;
+        std::size_t tokens = 0;
+        double seconds = 0.0;    // wall clock time, including discovery
+
+        // the time each worker spent reading, lexing and in the sink (only
+        // lexing in a pipelined run)
+        std::vector<double> busy_seconds;
+
+        // the time the reader thread of a pipelined run spent waiting for
+        // the files to be read, the time each consumer thread spent in the
+        // sink
+        double reader_busy_seconds = 0.0;
+        std::vector<double> consumer_busy_seconds;
+
+        [[nodiscard]] double files_per_second() const noexcept;
+        [[nodiscard]] double megabytes_per_second() const noexcept;
+        [[nodiscard]] double tokens_per_second() const noexcept;
+
+        // the fraction of the wall clock time the given worker was busy
+        [[nodiscard]] double utilization(std::size_t worker) const noexcept;
+    };
+
+    std::ostream& operator<<(
+        std::ostream& os, directory_lexer_stats const& stats);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  tokenize_directory
+    //
+    //      Recursively find all files having one of the configured extensions
+    //      below the given directory (symbolic links to directories are not
+    //      followed) and lex them into token_soa_buffer's on a pool of worker
+    //      threads. The files are handed out largest first, each worker takes
+    //      the next file once it is done with the previous one.
+    //
+    //      A worker waits before reading the next file, if the accumulated
+    //      size of the files being processed would exceed max_in_flight_bytes.
+    //      The input of a file is released after it was passed to the sink,
+    //      the token arrays of a worker are reused for its next file. The
+    //      files are read in chunks, they are not copied as a whole.
+    //
+    //      In a pipelined run reading, lexing and consuming overlap instead:
+    //      the reader thread reads whole files ahead using a file_prefetcher
+    //      (io_uring, or a thread pool if not available), these are handed
+    //      to the workers and from them to the consumer threads through
+    //      bounded lock-free queues. A stage waits while the queue to the
+    //      next one is full. The token arrays are reused by the workers once
+    //      the sink is done with them. The files being read ahead are not
+    //      accounted for by max_in_flight_bytes (see
+    //      file_prefetch_options::max_bytes).
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    directory_lexer_stats tokenize_directory(
+        std::filesystem::path const& directory, directory_sink& sink,
+        directory_lexer_options const& options = directory_lexer_options());
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
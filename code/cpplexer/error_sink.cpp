@@ -0,0 +1,63 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "error_sink.hpp"
+
+#include <version>
+
+#include <cassert>
+#include <cstddef>
+#include <string_view>
+
+#if defined(__cpp_lib_format)
+#include <format>
+#else
+#include <cstdio>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    std::string_view format_lexing_error(char* buffer, std::size_t size,
+        lexing_exception::error_code code, std::string_view detail) noexcept
+    {
+        assert(size != 0);
+
+        char const* severity = lexing_exception::severity_text(code);
+        char const* text = lexing_exception::error_text(code);
+        char const* separator = detail.empty() ? "" : ": ";
+
+#if defined(__cpp_lib_format)
+        auto const result = std::format_to_n(buffer, size - 1, "{}: {}{}{}",
+            severity, text, separator, detail);
+        std::size_t const length = result.out - buffer;
+#else
+        int const count = std::snprintf(buffer, size, "%s: %s%s%.*s",
+            severity, text, separator, static_cast<int>(detail.size()),
+            detail.data());
+        std::size_t const length = count < 0 ?
+            0 :
+            (static_cast<std::size_t>(count) < size ? count : size - 1);
+#endif
+        buffer[length] = 0;
+        return {buffer, length};
+    }
+
+    void report_lexing_error(error_sink* errors,
+        lexing_exception::error_code code, std::string_view detail,
+        std::size_t line, std::size_t column, char const* file_name)
+    {
+        char buffer[512];    // size of lexing_exception::description()
+        std::string_view const message =
+            format_lexing_error(buffer, sizeof(buffer), code, detail);
+
+        if (nullptr == errors)
+            throw lexing_exception(buffer, code, line, column, file_name);
+
+        errors->report(code, lexing_exception::severity_level(code), line,
+            column, message);
+    }
+}    // namespace wave::cpplexer
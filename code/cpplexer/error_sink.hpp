@@ -0,0 +1,58 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+#include "cpplexer_exceptions.hpp"
+
+#include <cstddef>
+#include <string_view>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  error_sink
+    //
+    //      Receives the diagnostics of a lexer instead of having them thrown
+    //      as a lexing_exception (see lex_iterator::set_error_sink). The
+    //      message is the same text as returned by
+    //      lexing_exception::description(), it refers to a temporary buffer
+    //      and is valid only during the call to report().
+    //
+    //      The lexer continues after a reported diagnostic: an invalid
+    //      character is returned as a token of the UnknownTokenType category,
+    //      invalid universal character names and long long suffixes are kept
+    //      in the token value.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    class error_sink
+    {
+    public:
+        virtual ~error_sink() = default;
+
+        virtual void report(lexing_exception::error_code code,
+            util::severity level, std::size_t line, std::size_t column,
+            std::string_view message) = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  format the description of a lexing error ("severity: error text:
+    //  detail") into the given buffer, the result is truncated if necessary
+    //  and is always zero terminated (size must not be zero)
+    std::string_view format_lexing_error(char* buffer, std::size_t size,
+        lexing_exception::error_code code, std::string_view detail) noexcept;
+
+    //  report a lexing error to the given sink or throw a lexing_exception
+    //  if no sink is given
+    void report_lexing_error(error_sink* errors,
+        lexing_exception::error_code code, std::string_view detail,
+        std::size_t line, std::size_t column, char const* file_name);
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
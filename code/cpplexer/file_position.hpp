@@ -14,6 +14,7 @@
 
 #include <ostream>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "config.hpp"
@@ -103,6 +104,96 @@ namespace wave::util {
 
     using file_position_type = file_position<WAVE_STRINGTYPE>;
 
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  file_position_without_column
+    //
+    //  A position holding the filename and the line number only. A lexer using
+    //  this position type does not keep track of the column positions at all,
+    //  get_column() always returns zero.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+
+    template <typename StringT>
+    struct file_position_without_column
+    {
+        using string_type = StringT;
+
+        file_position_without_column()
+          : file()
+          , line(1)
+        {
+        }
+        explicit file_position_without_column(
+            string_type file_, std::size_t line_ = 1, std::size_t = 0)
+          : file(std::move(file_))
+          , line(line_)
+        {
+        }
+
+        // accessors
+        [[nodiscard]] string_type const& get_file() const
+        {
+            return file;
+        }
+
+        [[nodiscard]] std::size_t get_line() const
+        {
+            return line;
+        }
+
+        [[nodiscard]] static constexpr std::size_t get_column() noexcept
+        {
+            return 0;
+        }
+
+        void set_file(string_type const& file_)
+        {
+            file = file_;
+        }
+        void set_line(std::size_t line_)
+        {
+            line = line_;
+        }
+        void set_column(std::size_t) {}
+
+    private:
+        string_type file;
+        std::size_t line;
+    };
+
+    template <typename StringT>
+    bool operator==(file_position_without_column<StringT> const& lhs,
+        file_position_without_column<StringT> const& rhs)
+    {
+        return lhs.get_line() == rhs.get_line() &&
+            lhs.get_file() == rhs.get_file();
+    }
+
+    template <typename StringT>
+    std::ostream& operator<<(
+        std::ostream& o, file_position_without_column<StringT> const& pos)
+    {
+        o << pos.get_file() << ":" << pos.get_line();
+        return o;
+    }
+
+    using file_position_without_column_type =
+        file_position_without_column<WAVE_STRINGTYPE>;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  true, if the lexer has to keep track of columns for the given position
+    //  type
+    template <typename PositionT>
+    struct has_column : std::true_type
+    {
+    };
+
+    template <typename StringT>
+    struct has_column<file_position_without_column<StringT>> : std::false_type
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     //
     //  position_iterator
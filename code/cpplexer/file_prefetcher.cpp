@@ -0,0 +1,700 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "file_prefetcher.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#if WAVE_USE_IO_URING != 0
+#include <atomic>
+#include <cstring>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        //  minimal wrappers for the file descriptor based I/O
+        int open_file(std::filesystem::path const& path)
+        {
+#if defined(_WIN32)
+            int const fd = ::_wopen(path.c_str(), _O_RDONLY | _O_BINARY);
+#else
+            int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+#endif
+            if (fd < 0)
+            {
+                throw std::runtime_error(
+                    "Could not open input file: " + path.string());
+            }
+            return fd;
+        }
+
+        void close_file(int fd) noexcept
+        {
+#if defined(_WIN32)
+            ::_close(fd);
+#else
+            ::close(fd);
+#endif
+        }
+
+        struct file_handle
+        {
+            explicit file_handle(std::filesystem::path const& path)
+              : fd(open_file(path))
+            {
+            }
+            file_handle(file_handle const&) = delete;
+            file_handle& operator=(file_handle const&) = delete;
+            ~file_handle()
+            {
+                close_file(fd);
+            }
+
+            int const fd;
+        };
+
+        // the size of the file at the time it is opened, 0 if unknown
+        std::size_t file_size(int fd) noexcept
+        {
+#if defined(_WIN32)
+            struct _stat64 info;
+            if (::_fstat64(fd, &info) != 0)
+                return 0;
+#else
+            struct stat info;
+            if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode))
+                return 0;
+#endif
+            return static_cast<std::size_t>(info.st_size);
+        }
+
+        // read at the given offset, returns the number of bytes read (less
+        // than requested at the end of the file only)
+        std::size_t read_at(
+            int fd, char* buffer, std::size_t count, std::size_t offset)
+        {
+            std::size_t done = 0;
+            while (done != count)
+            {
+                std::size_t const chunk =
+                    (std::min)(count - done, std::size_t(0x40000000));
+#if defined(_WIN32)
+                auto cnt = ::_lseeki64(fd, offset + done, SEEK_SET) < 0 ?
+                    -1 :
+                    ::_read(fd, buffer + done, static_cast<unsigned>(chunk));
+#else
+                auto cnt = ::pread(fd, buffer + done, chunk,
+                    static_cast<off_t>(offset + done));
+#endif
+                if (cnt < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    throw std::system_error(errno, std::generic_category(),
+                        "Could not read input file");
+                }
+                if (cnt == 0)
+                    break;
+                done += static_cast<std::size_t>(cnt);
+            }
+            return done;
+        }
+
+        // the contents hold the first 'done' bytes of the file, read the
+        // rest if the file has grown since its size was determined (or its
+        // size is unknown)
+        void read_remaining(int fd, std::string& contents, std::size_t done)
+        {
+            contents.resize(done);
+            char buffer[4096];
+            while (std::size_t const cnt =
+                       read_at(fd, buffer, sizeof(buffer), contents.size()))
+            {
+                contents.append(buffer, cnt);
+            }
+        }
+
+        void advise_will_need(int fd) noexcept
+        {
+#if defined(POSIX_FADV_WILLNEED)
+            ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+#else
+            (void) fd;
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        //  a file being read ahead
+        struct prefetch_slot
+        {
+            enum class state
+            {
+                empty,      // no file assigned
+                opened,     // opened, waiting for the read to be started
+                reading,    // the read was started
+                complete    // read or failed
+            };
+
+            prefetch_slot() = default;
+            prefetch_slot(prefetch_slot const&) = delete;
+            prefetch_slot& operator=(prefetch_slot const&) = delete;
+            ~prefetch_slot()
+            {
+                reset();
+            }
+
+            void reset() noexcept
+            {
+                if (fd >= 0)
+                    close_file(fd);
+                fd = -1;
+                status = state::empty;
+                size = 0;
+                done = 0;
+                accounted = 0;
+                contents = std::string();
+                error = nullptr;
+            }
+
+            int fd = -1;
+            state status = state::empty;
+            std::size_t size = 0;    // the expected size of the file
+            std::size_t done = 0;    // the number of bytes read so far
+            std::size_t accounted = 0;    // the bytes added to bytes_ahead
+            std::string contents;
+            std::exception_ptr error;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        //  the reads are either submitted to an io_uring or to a thread pool
+        class read_backend
+        {
+        public:
+            virtual ~read_backend() = default;
+
+            // start reading the (opened) file of the slot
+            virtual void start(prefetch_slot& slot) = 0;
+
+            // wait for the read of the file of the slot to complete
+            virtual void wait(prefetch_slot& slot) = 0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        class thread_backend final : public read_backend
+        {
+        public:
+            explicit thread_backend(std::size_t threads)
+            {
+                pool.reserve(threads);
+                for (std::size_t i = 0; i != threads; ++i)
+                    pool.emplace_back([this] { run(); });
+            }
+
+            ~thread_backend() override
+            {
+                {
+                    std::lock_guard<std::mutex> l(mtx);
+                    stop = true;
+                }
+                work_available.notify_all();
+                for (auto& t : pool)
+                    t.join();
+            }
+
+            void start(prefetch_slot& slot) override
+            {
+                // let the kernel read the file while the job is queued
+                advise_will_need(slot.fd);
+                {
+                    std::lock_guard<std::mutex> l(mtx);
+                    slot.status = prefetch_slot::state::reading;
+                    jobs.push_back(&slot);
+                }
+                work_available.notify_one();
+            }
+
+            void wait(prefetch_slot& slot) override
+            {
+                std::unique_lock<std::mutex> l(mtx);
+                completed.wait(l, [&] {
+                    return slot.status == prefetch_slot::state::complete;
+                });
+            }
+
+        private:
+            void run()
+            {
+                std::unique_lock<std::mutex> l(mtx);
+                while (true)
+                {
+                    work_available.wait(
+                        l, [&] { return stop || !jobs.empty(); });
+                    if (stop)
+                        return;
+
+                    prefetch_slot* slot = jobs.front();
+                    jobs.pop_front();
+                    l.unlock();
+
+                    try
+                    {
+                        slot->done = read_at(slot->fd, slot->contents.data(),
+                            slot->size, 0);
+                    }
+                    catch (...)
+                    {
+                        slot->error = std::current_exception();
+                    }
+
+                    l.lock();
+                    slot->status = prefetch_slot::state::complete;
+                    completed.notify_all();
+                }
+            }
+
+            std::mutex mtx;
+            std::condition_variable work_available;
+            std::condition_variable completed;
+            std::deque<prefetch_slot*> jobs;
+            bool stop = false;
+            std::vector<std::thread> pool;
+        };
+
+#if WAVE_USE_IO_URING != 0
+        ///////////////////////////////////////////////////////////////////////
+        //  The io_uring is used through the system calls directly (the
+        //  submission and completion queues are shared with the kernel),
+        //  there is at most one read per slot in flight.
+        class io_uring_backend final : public read_backend
+        {
+        public:
+            // returns nullptr if io_uring is not supported
+            static std::unique_ptr<read_backend> create(unsigned entries)
+            {
+                auto backend = std::unique_ptr<io_uring_backend>(
+                    new io_uring_backend());
+                if (!backend->setup(entries))
+                    return nullptr;
+                return backend;
+            }
+
+            ~io_uring_backend() override
+            {
+                // the kernel may still write to the buffers of the pending
+                // reads
+                while (in_flight != 0)
+                    reap(true);
+
+                if (sqes != nullptr)
+                    ::munmap(sqes, sqes_size);
+                if (cq_ring != nullptr && cq_ring != sq_ring)
+                    ::munmap(cq_ring, cq_ring_size);
+                if (sq_ring != nullptr)
+                    ::munmap(sq_ring, sq_ring_size);
+                if (ring_fd >= 0)
+                    ::close(ring_fd);
+            }
+
+            void start(prefetch_slot& slot) override
+            {
+                slot.status = prefetch_slot::state::reading;
+                submit(slot);
+            }
+
+            void wait(prefetch_slot& slot) override
+            {
+                while (slot.status != prefetch_slot::state::complete)
+                    reap(true);
+            }
+
+        private:
+            io_uring_backend() = default;
+
+            bool setup(unsigned entries)
+            {
+                io_uring_params params{};
+                ring_fd = static_cast<int>(
+                    ::syscall(__NR_io_uring_setup, entries, &params));
+                if (ring_fd < 0)
+                    return false;
+
+                sq_ring_size =
+                    params.sq_off.array + params.sq_entries * sizeof(unsigned);
+                cq_ring_size = params.cq_off.cqes +
+                    params.cq_entries * sizeof(io_uring_cqe);
+                bool const single_mmap =
+                    0 != (params.features & IORING_FEAT_SINGLE_MMAP);
+                if (single_mmap)
+                    sq_ring_size = cq_ring_size =
+                        (std::max)(sq_ring_size, cq_ring_size);
+
+                sq_ring = map(sq_ring_size, IORING_OFF_SQ_RING);
+                if (sq_ring == nullptr)
+                    return false;
+                cq_ring = single_mmap ? sq_ring :
+                                        map(cq_ring_size, IORING_OFF_CQ_RING);
+                if (cq_ring == nullptr)
+                    return false;
+                sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+                sqes = static_cast<io_uring_sqe*>(
+                    map(sqes_size, IORING_OFF_SQES));
+                if (sqes == nullptr)
+                    return false;
+
+                auto* sq = static_cast<char*>(sq_ring);
+                sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+                sq_mask =
+                    *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+                sq_array =
+                    reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+                auto* cq = static_cast<char*>(cq_ring);
+                cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+                cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+                cq_mask =
+                    *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+                cqes =
+                    reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+                return true;
+            }
+
+            void* map(std::size_t size, std::uint64_t offset) const noexcept
+            {
+                void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring_fd,
+                    static_cast<off_t>(offset));
+                return p == MAP_FAILED ? nullptr : p;
+            }
+
+            int enter(unsigned to_submit, unsigned min_complete,
+                unsigned flags) const noexcept
+            {
+                int result;
+                do
+                {
+                    result = static_cast<int>(::syscall(__NR_io_uring_enter,
+                        ring_fd, to_submit, min_complete, flags, nullptr, 0));
+                } while (result < 0 && errno == EINTR);
+                return result;
+            }
+
+            // submit a read of the remaining part of the file of the slot
+            void submit(prefetch_slot& slot)
+            {
+                unsigned const tail = *sq_tail;
+                unsigned const index = tail & sq_mask;
+
+                io_uring_sqe& sqe = sqes[index];
+                std::memset(&sqe, 0, sizeof(sqe));
+                sqe.opcode = IORING_OP_READ;
+                sqe.fd = slot.fd;
+                sqe.addr = reinterpret_cast<std::uint64_t>(
+                    slot.contents.data() + slot.done);
+                sqe.len = static_cast<std::uint32_t>((std::min)(
+                    slot.size - slot.done, std::size_t(0x40000000)));
+                sqe.off = slot.done;
+                sqe.user_data = reinterpret_cast<std::uint64_t>(&slot);
+
+                sq_array[index] = index;
+                std::atomic_ref<unsigned>(*sq_tail).store(
+                    tail + 1, std::memory_order_release);
+
+                if (enter(1, 0, 0) < 0)
+                {
+                    // take the entry back and read synchronously
+                    std::atomic_ref<unsigned>(*sq_tail).store(
+                        tail, std::memory_order_release);
+                    read_synchronously(slot);
+                    return;
+                }
+                ++in_flight;
+            }
+
+            void read_synchronously(prefetch_slot& slot) noexcept
+            {
+                try
+                {
+                    slot.done += read_at(slot.fd,
+                        slot.contents.data() + slot.done,
+                        slot.size - slot.done, slot.done);
+                }
+                catch (...)
+                {
+                    slot.error = std::current_exception();
+                }
+                slot.status = prefetch_slot::state::complete;
+            }
+
+            // process the available completions, waits for at least one if
+            // 'block' is set
+            void reap(bool block)
+            {
+                unsigned head = *cq_head;
+                unsigned tail = std::atomic_ref<unsigned>(*cq_tail).load(
+                    std::memory_order_acquire);
+                if (head == tail && block)
+                {
+                    if (enter(0, 1, IORING_ENTER_GETEVENTS) < 0)
+                    {
+                        throw std::system_error(errno,
+                            std::generic_category(),
+                            "Could not wait for io_uring completions");
+                    }
+                    tail = std::atomic_ref<unsigned>(*cq_tail).load(
+                        std::memory_order_acquire);
+                }
+
+                while (head != tail)
+                {
+                    io_uring_cqe const& cqe = cqes[head & cq_mask];
+                    auto* slot = reinterpret_cast<prefetch_slot*>(
+                        static_cast<std::uintptr_t>(cqe.user_data));
+                    int const result = cqe.res;
+
+                    ++head;
+                    std::atomic_ref<unsigned>(*cq_head).store(
+                        head, std::memory_order_release);
+                    --in_flight;
+
+                    complete(*slot, result);
+                }
+            }
+
+            void complete(prefetch_slot& slot, int result)
+            {
+                if (result == -EINTR || result == -EAGAIN)
+                {
+                    submit(slot);
+                }
+                else if (result == -EINVAL || result == -EOPNOTSUPP)
+                {
+                    // IORING_OP_READ is not supported by the kernel
+                    read_synchronously(slot);
+                }
+                else if (result < 0)
+                {
+                    slot.error =
+                        std::make_exception_ptr(std::system_error(-result,
+                            std::generic_category(),
+                            "Could not read input file"));
+                    slot.status = prefetch_slot::state::complete;
+                }
+                else
+                {
+                    slot.done += static_cast<std::size_t>(result);
+                    if (result != 0 && slot.done < slot.size)
+                        submit(slot);    // short read
+                    else
+                        slot.status = prefetch_slot::state::complete;
+                }
+            }
+
+            int ring_fd = -1;
+            std::size_t in_flight = 0;
+
+            void* sq_ring = nullptr;
+            void* cq_ring = nullptr;
+            io_uring_sqe* sqes = nullptr;
+            std::size_t sq_ring_size = 0;
+            std::size_t cq_ring_size = 0;
+            std::size_t sqes_size = 0;
+
+            unsigned* sq_tail = nullptr;
+            unsigned sq_mask = 0;
+            unsigned* sq_array = nullptr;
+            unsigned* cq_head = nullptr;
+            unsigned* cq_tail = nullptr;
+            unsigned cq_mask = 0;
+            io_uring_cqe* cqes = nullptr;
+        };
+#endif
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    std::string read_file(std::filesystem::path const& path)
+    {
+        file_handle const file(path);
+
+        std::size_t const size = file_size(file.fd);
+        std::string contents(size, '\0');
+        std::size_t const done = read_at(file.fd, contents.data(), size, 0);
+        read_remaining(file.fd, contents, done);
+        return contents;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  The file with the index i is read into slots[i % slots.size()], the
+    //  files [next_return, next_start) have been opened.
+    struct file_prefetcher::data
+    {
+        data(std::vector<std::filesystem::path> files_,
+            file_prefetch_options const& options_)
+          : files(std::move(files_))
+          , options(options_)
+          , slots((std::max)(options_.max_files, std::size_t(1)))
+        {
+#if WAVE_USE_IO_URING != 0
+            if (options.use_io_uring)
+            {
+                io = io_uring_backend::create(
+                    static_cast<unsigned>(slots.size()));
+                io_uring = io != nullptr;
+            }
+#endif
+            if (io == nullptr)
+            {
+                io = std::make_unique<thread_backend>((std::max)(
+                    (std::min)(options.threads, slots.size()), std::size_t(1)));
+            }
+        }
+
+        // open the next files and start reading them as far as the limits
+        // allow, the next file to return is always read
+        void fill()
+        {
+            while (next_start < files.size() &&
+                next_start < next_return + slots.size())
+            {
+                prefetch_slot& slot = slots[next_start % slots.size()];
+                if (slot.status == prefetch_slot::state::empty)
+                {
+                    try
+                    {
+                        slot.fd = open_file(files[next_start]);
+                        slot.size = file_size(slot.fd);
+                        slot.status = prefetch_slot::state::opened;
+                    }
+                    catch (...)
+                    {
+                        slot.error = std::current_exception();
+                        slot.status = prefetch_slot::state::complete;
+                    }
+                }
+
+                if (slot.status == prefetch_slot::state::opened)
+                {
+                    if (next_start != next_return &&
+                        bytes_ahead + slot.size > options.max_bytes)
+                    {
+                        break;
+                    }
+
+                    try
+                    {
+                        slot.contents.resize(slot.size);
+                    }
+                    catch (...)
+                    {
+                        slot.error = std::current_exception();
+                        slot.status = prefetch_slot::state::complete;
+                        ++next_start;
+                        continue;
+                    }
+                    slot.accounted = slot.size;
+                    bytes_ahead += slot.accounted;
+                    io->start(slot);
+                }
+                ++next_start;
+            }
+        }
+
+        bool next(prefetched_file& file)
+        {
+            if (next_return == files.size())
+                return false;
+
+            fill();
+
+            prefetch_slot& slot = slots[next_return % slots.size()];
+            io->wait(slot);
+
+            file.index = next_return;
+            file.error = slot.error;
+            if (!file.error)
+            {
+                try
+                {
+                    read_remaining(slot.fd, slot.contents, slot.done);
+                }
+                catch (...)
+                {
+                    file.error = std::current_exception();
+                }
+            }
+            file.contents =
+                file.error ? std::string() : std::move(slot.contents);
+
+            bytes_ahead -= slot.accounted;
+            slot.reset();
+            ++next_return;
+
+            // start the next reads before the caller processes this file
+            fill();
+            return true;
+        }
+
+        std::vector<std::filesystem::path> files;
+        file_prefetch_options options;
+        std::vector<prefetch_slot> slots;
+        std::unique_ptr<read_backend> io;    // destroyed before the slots
+        bool io_uring = false;
+
+        std::size_t next_start = 0;
+        std::size_t next_return = 0;
+        std::size_t bytes_ahead = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    file_prefetcher::file_prefetcher(std::vector<std::filesystem::path> files,
+        file_prefetch_options const& options)
+      : impl(std::make_unique<data>(std::move(files), options))
+    {
+    }
+
+    file_prefetcher::~file_prefetcher() = default;
+
+    bool file_prefetcher::next(prefetched_file& file)
+    {
+        return impl->next(file);
+    }
+
+    bool file_prefetcher::uses_io_uring() const noexcept
+    {
+        return impl->io_uring;
+    }
+}    // namespace wave::cpplexer
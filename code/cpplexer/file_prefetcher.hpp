@@ -0,0 +1,91 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  Read the whole file, throws a std::runtime_error if it can't be
+    //  opened and a std::system_error if reading fails.
+    std::string read_file(std::filesystem::path const& path);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    struct file_prefetch_options
+    {
+        // the maximal number of files being read ahead
+        std::size_t max_files = 16;
+
+        // the maximal accumulated size of the files being read ahead (the
+        // next file is read regardless of its size)
+        std::size_t max_bytes = std::size_t(64) * 1024 * 1024;
+
+        // the number of threads reading the files if io_uring is not used
+        std::size_t threads = 4;
+
+        // use io_uring if supported (see WAVE_USE_IO_URING)
+        bool use_io_uring = true;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  a file read by a file_prefetcher
+    struct prefetched_file
+    {
+        std::size_t index = 0;    // the index of the file in the list
+        std::string contents;
+        std::exception_ptr error;    // set if the file couldn't be read
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  file_prefetcher
+    //
+    //      Returns the contents of the given files in order, while the
+    //      following files are read in the background. Whenever a file is
+    //      taken, the reads of the next files are started (limited by the
+    //      options), thus the files are read while the caller processes the
+    //      previous ones.
+    //
+    //      The reads are submitted to an io_uring if it is available,
+    //      otherwise the kernel is asked to read the files ahead
+    //      (posix_fadvise(POSIX_FADV_WILLNEED)) and they are read by a pool of
+    //      threads. The prefetcher has to be used from a single thread.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    class file_prefetcher
+    {
+    public:
+        explicit file_prefetcher(std::vector<std::filesystem::path> files,
+            file_prefetch_options const& options = file_prefetch_options());
+        ~file_prefetcher();
+
+        file_prefetcher(file_prefetcher const&) = delete;
+        file_prefetcher& operator=(file_prefetcher const&) = delete;
+
+        // wait for the next file to be read, returns false if all files
+        // were returned already
+        bool next(prefetched_file& file);
+
+        // true, if the files are read using io_uring
+        [[nodiscard]] bool uses_io_uring() const noexcept;
+
+    private:
+        struct data;
+        std::unique_ptr<data> impl;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
@@ -0,0 +1,212 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "identifier_interner.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    namespace {
+
+        // the shard of an identifier is selected by the upper bits of its
+        // hash, the slot in the hash table of the shard by the lower ones
+        constexpr unsigned shard_bits = 6;
+        constexpr std::size_t shard_count = std::size_t(1) << shard_bits;
+
+        // the ids hold the shard in their lower bits and the (one based)
+        // index of the identifier in the shard in the upper ones
+        constexpr std::size_t max_shard_size =
+            (std::size_t(1) << (32 - shard_bits)) - 1;
+
+        constexpr std::size_t initial_table_size = 64;
+        constexpr std::size_t block_size = 64 * 1024;
+
+        constexpr std::size_t shard_of_hash(std::uint32_t hash) noexcept
+        {
+            return hash >> (32 - shard_bits);
+        }
+        constexpr std::size_t shard_of_id(symbol_id id) noexcept
+        {
+            return id & (shard_count - 1);
+        }
+        constexpr std::size_t index_of(symbol_id id) noexcept
+        {
+            return (id >> shard_bits) - 1;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    struct identifier_interner::shard
+    {
+        struct slot
+        {
+            std::uint32_t hash = 0;
+            symbol_id id = no_symbol;    // no_symbol marks an empty slot
+        };
+
+        // the slot holding the given identifier, or the empty slot it would
+        // be inserted at (linear probing)
+        slot* find_slot(std::string_view name, std::uint32_t hash) noexcept
+        {
+            std::size_t const mask = table.size() - 1;
+            for (std::size_t i = hash & mask;; i = (i + 1) & mask)
+            {
+                slot& s = table[i];
+                if (s.id == no_symbol ||
+                    (s.hash == hash && names[index_of(s.id)] == name))
+                {
+                    return &s;
+                }
+            }
+        }
+
+        symbol_id add(slot* s, std::string_view name, std::uint32_t hash,
+            std::size_t shard_index);
+        void grow();
+        char* allocate(std::size_t size);
+
+        mutable std::shared_mutex mtx;
+        std::vector<slot> table = std::vector<slot>(initial_table_size);
+        std::vector<std::string_view> names;
+
+        // the storage of the names
+        std::vector<std::unique_ptr<char[]>> blocks;
+        char* unused = nullptr;
+        std::size_t unused_size = 0;
+    };
+
+    symbol_id identifier_interner::shard::add(slot* s, std::string_view name,
+        std::uint32_t hash, std::size_t shard_index)
+    {
+        if (names.size() == max_shard_size)
+        {
+            throw std::length_error(
+                "identifier_interner: too many distinct identifiers");
+        }
+
+        char* stored = allocate(name.size());
+        std::memcpy(stored, name.data(), name.size());
+        names.emplace_back(stored, name.size());
+
+        auto const id =
+            static_cast<symbol_id>((names.size() << shard_bits) | shard_index);
+        s->hash = hash;
+        s->id = id;
+
+        // keep the load factor of the table below 1/2
+        if (names.size() * 2 > table.size())
+            grow();
+        return id;
+    }
+
+    void identifier_interner::shard::grow()
+    {
+        std::vector<slot> old(table.size() * 2);
+        old.swap(table);
+
+        std::size_t const mask = table.size() - 1;
+        for (slot const& s : old)
+        {
+            if (s.id == no_symbol)
+                continue;
+
+            std::size_t i = s.hash & mask;
+            while (table[i].id != no_symbol)
+                i = (i + 1) & mask;
+            table[i] = s;
+        }
+    }
+
+    char* identifier_interner::shard::allocate(std::size_t size)
+    {
+        if (size > unused_size)
+        {
+            std::size_t const capacity = (std::max)(size, block_size);
+            blocks.push_back(std::make_unique<char[]>(capacity));
+            unused = blocks.back().get();
+            unused_size = capacity;
+        }
+
+        char* result = unused;
+        unused += size;
+        unused_size -= size;
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    identifier_interner::identifier_interner()
+      : shards(std::make_unique<shard[]>(shard_count))
+    {
+    }
+
+    identifier_interner::~identifier_interner() = default;
+
+    symbol_id identifier_interner::intern(
+        std::string_view name, std::uint32_t hash)
+    {
+        assert(hash == hash_identifier(name));
+
+        std::size_t const shard_index = shard_of_hash(hash);
+        shard& s = shards[shard_index];
+        {
+            std::shared_lock<std::shared_mutex> l(s.mtx);
+            symbol_id const id = s.find_slot(name, hash)->id;
+            if (id != no_symbol)
+                return id;
+        }
+
+        // the identifier may have been added while no lock was held
+        std::lock_guard<std::shared_mutex> l(s.mtx);
+        shard::slot* slot = s.find_slot(name, hash);
+        if (slot->id != no_symbol)
+            return slot->id;
+        return s.add(slot, name, hash, shard_index);
+    }
+
+    symbol_id identifier_interner::find(std::string_view name) const
+    {
+        std::uint32_t const hash = hash_identifier(name);
+        shard& s = shards[shard_of_hash(hash)];
+
+        std::shared_lock<std::shared_mutex> l(s.mtx);
+        return s.find_slot(name, hash)->id;
+    }
+
+    std::string_view identifier_interner::name(symbol_id id) const
+    {
+        assert(id != no_symbol);
+        shard const& s = shards[shard_of_id(id)];
+
+        std::shared_lock<std::shared_mutex> l(s.mtx);
+        assert(index_of(id) < s.names.size());
+        return s.names[index_of(id)];
+    }
+
+    std::size_t identifier_interner::size() const
+    {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i != shard_count; ++i)
+        {
+            std::shared_lock<std::shared_mutex> l(shards[i].mtx);
+            result += shards[i].names.size();
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
@@ -0,0 +1,108 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  the id of an identifier interned by an identifier_interner, no_symbol
+    //  is never assigned to an identifier
+    using symbol_id = std::uint32_t;
+
+    inline constexpr symbol_id no_symbol = 0;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  The hash of an identifier (32 bit FNV-1a). The lexer computes it
+    //  character by character while it validates the identifier, thus the
+    //  interner has to be given the same value.
+    inline constexpr std::uint32_t identifier_hash_seed = 2166136261u;
+
+    constexpr std::uint32_t hash_identifier_char(
+        std::uint32_t hash, char c) noexcept
+    {
+        return (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+
+    constexpr std::uint32_t hash_identifier(std::string_view name) noexcept
+    {
+        std::uint32_t hash = identifier_hash_seed;
+        for (char c : name)
+            hash = hash_identifier_char(hash, c);
+        return hash;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  identifier_interner
+    //
+    //      Assigns a unique 32 bit id to each distinct identifier, thus two
+    //      identifiers interned by the same interner are equal if their ids
+    //      are equal. A lexer given an interner (see
+    //      lex_iterator::set_identifier_interner) interns all T_IDENTIFIER
+    //      tokens, the hash is computed in the pass validating the
+    //      identifier characters and the id is stored in the token.
+    //
+    //      The interner can be shared by any number of threads. The
+    //      identifiers are distributed over a number of shards by their hash,
+    //      each having its own hash table and lock. Looking up an identifier
+    //      known already takes a shared lock only. The names are copied into
+    //      storage owned by the interner, they remain valid (and their ids
+    //      assigned) until the interner is destroyed.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    class identifier_interner
+    {
+    public:
+        identifier_interner();
+        ~identifier_interner();
+
+        identifier_interner(identifier_interner const&) = delete;
+        identifier_interner& operator=(identifier_interner const&) = delete;
+
+        // the id of the given identifier, it is added if not known yet. The
+        // hash has to be the hash_identifier() of the name. Throws a
+        // std::length_error if the ids of a shard are exhausted.
+        symbol_id intern(std::string_view name, std::uint32_t hash);
+        symbol_id intern(std::string_view name)
+        {
+            return intern(name, hash_identifier(name));
+        }
+
+        // the id of the given identifier or no_symbol if it wasn't interned
+        [[nodiscard]] symbol_id find(std::string_view name) const;
+
+        // the identifier having the given id (which has to be assigned by
+        // this interner)
+        [[nodiscard]] std::string_view name(symbol_id id) const;
+
+        // the number of interned identifiers
+        [[nodiscard]] std::size_t size() const;
+
+    private:
+        struct shard;
+        std::unique_ptr<shard[]> shards;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  the id of an identifier and the interner which assigned it, ids are
+    //  comparable only if they were assigned by the same interner
+    struct interned_identifier
+    {
+        identifier_interner const* interner = nullptr;
+        symbol_id id = no_symbol;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
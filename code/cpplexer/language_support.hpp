@@ -56,7 +56,7 @@ namespace wave {
 #endif
 #endif
 
-        support_option_mask = 0xFFC0,
+        support_option_mask = 0x30FFC0,
         support_option_emit_contnewlines = 0x0040,
         support_option_insert_whitespace = 0x0080,
         support_option_preserve_comments = 0x0100,
@@ -66,7 +66,9 @@ namespace wave {
         support_option_prefer_pp_numbers = 0x1000,
         support_option_emit_line_directives = 0x2000,
         support_option_include_guard_detection = 0x4000,
-        support_option_emit_pragma_directives = 0x8000
+        support_option_emit_pragma_directives = 0x8000,
+        support_option_lazy_token_values = 0x100000,
+        support_option_decode_numeric_literals = 0x200000
     };
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -235,8 +237,13 @@ namespace wave {
     WAVE_OPTION(
         emit_pragma_directives)       // support_option_emit_pragma_directives
 #endif
+    WAVE_OPTION(
+        include_guard_detection)    // support_option_include_guard_detection
     WAVE_OPTION(insert_whitespace)    // support_option_insert_whitespace
     WAVE_OPTION(emit_contnewlines)    // support_option_emit_contnewlines
+    WAVE_OPTION(lazy_token_values)    // support_option_lazy_token_values
+    WAVE_OPTION(
+        decode_numeric_literals)    // support_option_decode_numeric_literals
 #if WAVE_SUPPORT_CPP0X != 0
     WAVE_OPTION(
         no_newline_at_end_of_file)    // support_no_newline_at_end_of_file
@@ -0,0 +1,67 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+#include "error_sink.hpp"
+#include "file_position.hpp"
+#include "language_support.hpp"
+#include "token_ids.hpp"
+
+#include <cstddef>
+#include <string_view>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  lex
+    //
+    //      Lex the given input calling the visitor for each token directly
+    //      from the scanner loop:
+    //
+    //          visitor(token_id id, std::string_view value,
+    //              std::size_t line, std::size_t column)
+    //
+    //      No token objects are created, the token values are not copied and
+    //      the visitor is called without any indirection (it is a template
+    //      parameter, so the call can be inlined). If the visitor returns a
+    //      bool, lexing stops as soon as it returns false.
+    //
+    //      The value of a token is its spelling in the (line splice free)
+    //      input, i.e. trigraphs are not converted and the values of
+    //      identifiers and literals are not validated. It refers to the
+    //      buffer of the scanner and is valid only during the call. The
+    //      #include_next directives have their ..._NEXT token id. The final
+    //      T_EOF token is not passed to the visitor.
+    //
+    //      The columns are tracked only if the position type has one,
+    //      otherwise the column of the given position is passed for all
+    //      tokens.
+    //
+    //      The lexer errors are thrown as a lexing_exception or reported to
+    //      the given error sink. Returns false if the visitor stopped
+    //      lexing, true otherwise.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename IteratorT, typename PositionT, typename VisitorT>
+    bool lex(IteratorT const& first, IteratorT const& last,
+        PositionT const& pos, language_support language, VisitorT&& visitor,
+        error_sink* errors = nullptr);
+
+    // lex the given text, the line and column of the first character are 1
+    template <typename VisitorT>
+    bool lex(std::string_view buffer, VisitorT&& visitor,
+        language_support language = language_support(
+            support_cpp | support_cpp20 | support_option_long_long),
+        error_sink* errors = nullptr);
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
+
+#include "re2clex/cpp_re2c_visit.hpp"
@@ -0,0 +1,101 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "line_index.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    std::size_t line_index::line(std::size_t offset) const noexcept
+    {
+        // the first line starting after the offset follows the line
+        // containing it
+        return std::upper_bound(starts.begin(), starts.end(), offset) -
+            starts.begin();
+    }
+
+    std::size_t line_index::column(std::size_t offset) const noexcept
+    {
+        return offset - starts[line(offset) - 1] + 1;
+    }
+
+    std::size_t line_index::offset(std::size_t line) const noexcept
+    {
+        if (line == 0 || line > starts.size())
+            return end_offset;
+        return starts[line - 1];
+    }
+
+    void line_index::add_chunk(unsigned char const* data, std::size_t size,
+        std::size_t offset, std::span<std::size_t const> splices,
+        bool at_end)
+    {
+        if (offset + size >= (std::numeric_limits<std::uint32_t>::max)())
+            throw std::length_error("line_index: input exceeds 4GB");
+
+        std::size_t const first_new = starts.size();
+
+        // a '\r' at the end of the previous chunk is a newline of its own,
+        // unless it is followed by a '\n'
+        if (pending_cr && (size == 0 || data[0] != '\n'))
+            starts.push_back(static_cast<std::uint32_t>(offset));
+        pending_cr = false;
+
+        // the newlines are found using memchr, a '\r' is searched for
+        // separately as most of the inputs do not contain any
+        if (size != 0)
+        {
+            unsigned char const* const end = data + size;
+            auto const find = [end](unsigned char const* p, int ch) {
+                auto const* found = static_cast<unsigned char const*>(
+                    std::memchr(p, ch, end - p));
+                return found != nullptr ? found : end;
+            };
+
+            unsigned char const* lf = find(data, '\n');
+            unsigned char const* cr = find(data, '\r');
+            while (lf != end || cr != end)
+            {
+                if (lf < cr)
+                {
+                    starts.push_back(
+                        static_cast<std::uint32_t>(offset + (lf - data) + 1));
+                    lf = find(lf + 1, '\n');
+                    continue;
+                }
+
+                // a '\r\n' is a single newline, recorded at its '\n'
+                unsigned char const* const next = cr + 1;
+                if (next == end && !at_end)
+                    pending_cr = true;
+                else if (next == end || *next != '\n')
+                    starts.push_back(
+                        static_cast<std::uint32_t>(offset + (next - data)));
+                cr = find(next, '\r');
+            }
+        }
+
+        // the line splices are merged into the newly found line starts
+        if (!splices.empty())
+        {
+            std::size_t const first_splice = starts.size();
+            for (std::size_t splice : splices)
+                starts.push_back(static_cast<std::uint32_t>(splice));
+            std::inplace_merge(starts.begin() + first_new,
+                starts.begin() + first_splice, starts.end());
+        }
+
+        end_offset = offset + size;
+    }
+}    // namespace wave::cpplexer
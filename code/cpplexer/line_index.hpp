@@ -0,0 +1,88 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  line_index
+    //
+    //      The start offsets of the physical lines of the input of a lexer
+    //      (see lex_iterator::set_line_index), recorded while the scanner
+    //      reads its input. The offsets refer to the input with the line
+    //      splices (backslash-newline) removed, i.e. the same offsets as
+    //      used by token_value_ref and token_soa_buffer. A removed line
+    //      splice starts a new physical line as well, thus the line numbers
+    //      match the ones reported by the lexer.
+    //
+    //      Lines are numbered starting at 1, columns are counted in bytes
+    //      from the start of the physical line (starting at 1 as well). The
+    //      lookups are binary searches.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    class line_index
+    {
+    public:
+        line_index()
+          : starts(1, 0)
+        {
+        }
+
+        // the first line always starts at offset zero
+        void clear() noexcept
+        {
+            starts.resize(1);
+            end_offset = 0;
+            pending_cr = false;
+        }
+
+        // the number of lines seen so far
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return starts.size();
+        }
+
+        [[nodiscard]] std::span<std::uint32_t const> line_starts()
+            const noexcept
+        {
+            return starts;
+        }
+
+        // the line containing the given offset
+        [[nodiscard]] std::size_t line(std::size_t offset) const noexcept;
+
+        // the column of the given offset
+        [[nodiscard]] std::size_t column(std::size_t offset) const noexcept;
+
+        // the offset of the first character of the given line, the end
+        // of the input seen so far if the line is out of range
+        [[nodiscard]] std::size_t offset(std::size_t line) const noexcept;
+
+        // record the line starts of a chunk of input starting at 'offset',
+        // 'splices' are the (ascending) offsets of the line splices removed
+        // from it, 'at_end' is true for the last chunk of the input
+        void add_chunk(unsigned char const* data, std::size_t size,
+            std::size_t offset, std::span<std::size_t const> splices,
+            bool at_end);
+
+    private:
+        std::vector<std::uint32_t> starts;
+        std::size_t end_offset = 0;
+        bool pending_cr = false;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
@@ -0,0 +1,307 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "numeric_literal.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <system_error>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    namespace {
+
+        // the value of a digit in any base up to 16, 16 for other characters
+        constexpr unsigned digit_value(char c) noexcept
+        {
+            if (c >= '0' && c <= '9')
+                return c - '0';
+            if (c >= 'a' && c <= 'f')
+                return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F')
+                return c - 'A' + 10;
+            return 16;
+        }
+
+        constexpr bool is_unsigned_suffix(char c) noexcept
+        {
+            return c == 'u' || c == 'U';
+        }
+
+        // u, l, ll, z and their combinations (the unsigned part may precede
+        // or follow the others), as well as i64
+        bool decode_integer_suffix(
+            std::string_view suffix, numeric_suffix& result) noexcept
+        {
+            if (suffix == "i64")
+            {
+                result = numeric_suffix::ll;
+                return true;
+            }
+
+            bool is_unsigned = false;
+            if (!suffix.empty() && is_unsigned_suffix(suffix.front()))
+            {
+                is_unsigned = true;
+                suffix.remove_prefix(1);
+            }
+
+            numeric_suffix size = numeric_suffix::none;
+            if (suffix.starts_with("ll") || suffix.starts_with("LL"))
+            {
+                size = numeric_suffix::ll;
+                suffix.remove_prefix(2);
+            }
+            else if (!suffix.empty() &&
+                (suffix.front() == 'l' || suffix.front() == 'L'))
+            {
+                size = numeric_suffix::l;
+                suffix.remove_prefix(1);
+            }
+            else if (!suffix.empty() &&
+                (suffix.front() == 'z' || suffix.front() == 'Z'))
+            {
+                size = numeric_suffix::z;
+                suffix.remove_prefix(1);
+            }
+
+            if (!is_unsigned && !suffix.empty() &&
+                is_unsigned_suffix(suffix.front()))
+            {
+                is_unsigned = true;
+                suffix.remove_prefix(1);
+            }
+            if (!suffix.empty())
+                return false;
+
+            switch (size)
+            {
+            case numeric_suffix::l:
+                result = is_unsigned ? numeric_suffix::ul : numeric_suffix::l;
+                break;
+            case numeric_suffix::ll:
+                result =
+                    is_unsigned ? numeric_suffix::ull : numeric_suffix::ll;
+                break;
+            case numeric_suffix::z:
+                result = is_unsigned ? numeric_suffix::uz : numeric_suffix::z;
+                break;
+            default:
+                result =
+                    is_unsigned ? numeric_suffix::u : numeric_suffix::none;
+                break;
+            }
+            return true;
+        }
+
+        bool decode_floating_suffix(
+            std::string_view suffix, numeric_suffix& result) noexcept
+        {
+            struct known_suffix
+            {
+                std::string_view lower;
+                std::string_view upper;
+                numeric_suffix value;
+            };
+            static constexpr known_suffix known[] = {
+                {"", "", numeric_suffix::none},
+                {"f", "F", numeric_suffix::f},
+                {"l", "L", numeric_suffix::l},
+                {"f16", "F16", numeric_suffix::f16},
+                {"f32", "F32", numeric_suffix::f32},
+                {"f64", "F64", numeric_suffix::f64},
+                {"f128", "F128", numeric_suffix::f128},
+                {"bf16", "BF16", numeric_suffix::bf16},
+            };
+
+            for (known_suffix const& s : known)
+            {
+                if (suffix == s.lower || suffix == s.upper)
+                {
+                    result = s.value;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // the digits of the given base starting at 'pos' (separators have to
+        // be in between two digits), returns the position following them
+        std::size_t skip_digits(std::string_view text, std::size_t pos,
+            unsigned base, std::size_t& digits) noexcept
+        {
+            digits = 0;
+            for (; pos != text.size(); ++pos)
+            {
+                if (text[pos] == '\'')
+                {
+                    if (digits == 0 || pos + 1 == text.size() ||
+                        digit_value(text[pos + 1]) >= base)
+                    {
+                        break;
+                    }
+                }
+                else if (digit_value(text[pos]) < base)
+                {
+                    ++digits;
+                }
+                else
+                {
+                    break;
+                }
+            }
+            return pos;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        numeric_literal decode_integer(std::string_view text) noexcept
+        {
+            numeric_literal result;
+
+            unsigned base = 10;
+            std::size_t start = 0;
+            if (text.size() > 1 && text[0] == '0')
+            {
+                if (text[1] == 'x' || text[1] == 'X')
+                {
+                    base = 16;
+                    start = 2;
+                }
+                else if (text[1] == 'b' || text[1] == 'B')
+                {
+                    base = 2;
+                    start = 2;
+                }
+                else
+                {
+                    base = 8;
+                }
+            }
+
+            std::size_t digits = 0;
+            std::size_t const end = skip_digits(text, start, base, digits);
+            if (digits == 0 ||
+                !decode_integer_suffix(text.substr(end), result.suffix))
+            {
+                return result;
+            }
+
+            constexpr std::uint64_t max_value =
+                (std::numeric_limits<std::uint64_t>::max)();
+
+            std::uint64_t value = 0;
+            for (std::size_t i = start; i != end; ++i)
+            {
+                if (text[i] == '\'')
+                    continue;
+
+                unsigned const digit = digit_value(text[i]);
+                if (value > (max_value - digit) / base)
+                    result.overflow = true;
+                value = value * base + digit;
+            }
+
+            result.kind = numeric_literal_kind::integer;
+            result.integer = value;
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        numeric_literal decode_floating(std::string_view text) noexcept
+        {
+            numeric_literal result;
+
+            bool const is_hex = text.size() > 1 && text[0] == '0' &&
+                (text[1] == 'x' || text[1] == 'X');
+            unsigned const base = is_hex ? 16 : 10;
+            std::size_t const start = is_hex ? 2 : 0;
+
+            // the significand, the fractional part may be empty
+            std::size_t digits = 0;
+            std::size_t fraction_digits = 0;
+            std::size_t end = skip_digits(text, start, base, digits);
+            if (end != text.size() && text[end] == '.')
+                end = skip_digits(text, end + 1, base, fraction_digits);
+            if (digits + fraction_digits == 0)
+                return result;
+
+            // the exponent is required for hexadecimal literals
+            char const exponent_lower = is_hex ? 'p' : 'e';
+            char const exponent_upper = is_hex ? 'P' : 'E';
+            if (end != text.size() &&
+                (text[end] == exponent_lower || text[end] == exponent_upper))
+            {
+                std::size_t pos = end + 1;
+                if (pos != text.size() &&
+                    (text[pos] == '+' || text[pos] == '-'))
+                {
+                    ++pos;
+                }
+
+                std::size_t exponent_digits = 0;
+                end = skip_digits(text, pos, 10, exponent_digits);
+                if (exponent_digits == 0)
+                    return result;
+            }
+            else if (is_hex)
+            {
+                return result;
+            }
+
+            if (!decode_floating_suffix(text.substr(end), result.suffix))
+                return result;
+
+            // std::from_chars doesn't accept digit separators nor the prefix
+            // of a hexadecimal literal, literals longer than the buffer are
+            // very unlikely
+            char buffer[256];
+            std::size_t length = 0;
+            for (std::size_t i = start; i != end; ++i)
+            {
+                if (text[i] == '\'')
+                    continue;
+                if (length == sizeof(buffer))
+                    return result;
+                buffer[length++] = text[i];
+            }
+
+            double value = 0;
+            auto const [ptr, ec] = std::from_chars(buffer, buffer + length,
+                value,
+                is_hex ? std::chars_format::hex : std::chars_format::general);
+            if (ptr != buffer + length ||
+                (ec != std::errc() && ec != std::errc::result_out_of_range))
+            {
+                return result;
+            }
+
+            result.kind = numeric_literal_kind::floating;
+            result.overflow = ec == std::errc::result_out_of_range;
+            result.floating = value;
+            return result;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    numeric_literal decode_numeric_literal(std::string_view text) noexcept
+    {
+        // a decimal point or an exponent makes it a floating point literal
+        bool const is_hex = text.size() > 1 && text[0] == '0' &&
+            (text[1] == 'x' || text[1] == 'X');
+        if (text.find_first_of(is_hex ? ".pP" : ".eE") !=
+            std::string_view::npos)
+        {
+            return decode_floating(text);
+        }
+        return decode_integer(text);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
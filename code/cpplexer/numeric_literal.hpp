@@ -0,0 +1,78 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+
+#include <cstdint>
+#include <string_view>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    enum class numeric_literal_kind : std::uint8_t
+    {
+        none,        // not decoded (or not a valid literal)
+        integer,     // the value is numeric_literal::integer
+        floating     // the value is numeric_literal::floating
+    };
+
+    //  the suffix of a numeric literal, 'l' is long for integers and long
+    //  double for floating point literals
+    enum class numeric_suffix : std::uint8_t
+    {
+        none,
+        u,       // unsigned
+        l,       // long, long double
+        ul,      // unsigned long
+        ll,      // long long (or the Microsoft specific i64)
+        ull,     // unsigned long long
+        z,       // signed size_t
+        uz,      // size_t
+        f,       // float
+        f16,     // std::float16_t
+        f32,     // std::float32_t
+        f64,     // std::float64_t
+        f128,    // std::float128_t
+        bf16     // std::bfloat16_t
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  numeric_literal
+    //
+    //      The value of an integer or floating point literal. Integers are
+    //      decoded into 64 bits (as used by the preprocessor to evaluate #if
+    //      expressions), floating point literals into a double. If the value
+    //      isn't representable, 'overflow' is set and the value is
+    //      unspecified.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    struct numeric_literal
+    {
+        numeric_literal_kind kind = numeric_literal_kind::none;
+        numeric_suffix suffix = numeric_suffix::none;
+        bool overflow = false;
+
+        union
+        {
+            std::uint64_t integer = 0;
+            double floating;
+        };
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  Decode the text of an integer or floating point literal (decimal,
+    //  hexadecimal, octal, or binary, with digit separators and a standard
+    //  suffix). Returns a literal of the kind numeric_literal_kind::none if
+    //  the text isn't such a literal (e.g. a pp-number which isn't a valid
+    //  literal or a literal having a user defined suffix).
+    numeric_literal decode_numeric_literal(std::string_view text) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
@@ -186,6 +186,15 @@ namespace wave::cpplexer::re2clex {
         return q;
     }
 
+    void aq_clear(aq_queue q)
+    {
+        assert(NULL != q);
+
+        q->head = 0;
+        q->tail = q->max_size - 1;
+        q->size = 0;
+    }
+
     void aq_terminate(aq_queue q)
     {
         using namespace std;    // some systems have free in std
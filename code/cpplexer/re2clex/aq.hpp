@@ -42,6 +42,7 @@ namespace wave::cpplexer::re2clex {
 
     WAVE_DECL aq_queue aq_create();
     WAVE_DECL void aq_terminate(aq_queue q);
+    WAVE_DECL void aq_clear(aq_queue q);
 
     ///////////////////////////////////////////////////////////////////////////////
 }    // namespace wave::cpplexer::re2clex
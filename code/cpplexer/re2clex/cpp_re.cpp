@@ -30,41 +30,4 @@ namespace wave::cpplexer::re2clex {
         }
         return false;
     }
-
-    ///////////////////////////////////////////////////////////////////////////////
-    //  Special wrapper class holding the current cursor position
-    uchar_wrapper::uchar_wrapper(uchar* base_cursor, std::size_t column)
-      : base_cursor(base_cursor)
-      , column(column)
-    {
-    }
-
-    uchar_wrapper& uchar_wrapper::operator++()
-    {
-        ++base_cursor;
-        ++column;
-        return *this;
-    }
-
-    uchar_wrapper& uchar_wrapper::operator--()
-    {
-        --base_cursor;
-        --column;
-        return *this;
-    }
-
-    uchar uchar_wrapper::operator*() const
-    {
-        return *base_cursor;
-    }
-
-    uchar_wrapper::operator uchar*() const
-    {
-        return base_cursor;
-    }
-
-    std::ptrdiff_t operator-(uchar_wrapper const& lhs, uchar_wrapper const& rhs)
-    {
-        return lhs.base_cursor - rhs.base_cursor;
-    }
 }    // namespace wave::cpplexer::re2clex
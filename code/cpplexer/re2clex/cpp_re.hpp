@@ -12,14 +12,26 @@
 
 #pragma once
 
+#include <bit>
 #include <cassert>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <vector>
 
+#include "../buffer_pool.hpp"
 #include "../config.hpp"
 #include "../cpplexer_exceptions.hpp"
+#include "../stream_input.hpp"
 #include "../token_ids.hpp"
 #include "aq.hpp"
 #include "scanner.hpp"
 
+#if WAVE_USE_SSE2
+#include <emmintrin.h>
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 #define YYCTYPE uchar
 #define YYCURSOR cursor
@@ -27,8 +39,10 @@
 #define YYMARKER marker
 #define YYFILL(n)                                                              \
     {                                                                          \
-        cursor = uchar_wrapper(fill(s, cursor), cursor.column);                \
-        limit = uchar_wrapper(s->lim);                                         \
+        s->ptr = marker; /* fill() may move the buffer */                      \
+        set_cursor(cursor, fill(s, cursor));                                   \
+        set_cursor(marker, s->ptr);                                            \
+        set_cursor(limit, s->lim);                                             \
     }                                                                          \
     /**/
 
@@ -36,7 +50,7 @@
 #define WAVE_UPDATE_CURSOR()                                                   \
     {                                                                          \
         s->line += count_backslash_newlines(s, cursor);                        \
-        s->curr_column = cursor.column;                                        \
+        store_column(s->curr_column, cursor);                                  \
         s->cur = cursor;                                                       \
         s->lim = limit;                                                        \
         s->ptr = marker;                                                       \
@@ -59,9 +73,12 @@ namespace wave::cpplexer::re2clex {
     template <typename Iterator>
     struct Scanner;
 
+    struct uchar_wrapper;
+
     ///////////////////////////////////////////////////////////////////////////////
-    //  The scanner function to call whenever a new token is requested
-    template <typename Iterator>
+    //  The scanner function to call whenever a new token is requested, the
+    //  columns are tracked only if the cursor is a uchar_wrapper (see below)
+    template <typename Cursor = uchar_wrapper, typename Iterator>
     token_id scan(Scanner<Iterator>* s);
     ///////////////////////////////////////////////////////////////////////////////
 
@@ -87,10 +104,96 @@ namespace wave::cpplexer::re2clex {
         return std::distance(s->first, s->act);
     }
 
+    template <typename Iterator>
+    std::ptrdiff_t read_input(
+        Scanner<Iterator>* s, uchar* dst, std::ptrdiff_t count)
+    {
+        std::ptrdiff_t cnt = std::distance(s->act, s->last);
+        if (cnt > count)
+            cnt = count;
+        if constexpr (std::contiguous_iterator<Iterator>)
+        {
+            if (cnt > 0)
+                std::memcpy(dst, std::to_address(s->act), cnt);
+            s->act += cnt;
+        }
+        else
+        {
+            for (std::ptrdiff_t idx = 0; idx < cnt; ++idx)
+            {
+                *dst++ = *s->act++;
+            }
+        }
+        return cnt;
+    }
+
+    //  give the last 'cnt' characters read back to the input, returns false
+    //  if the input can't be rewound
+    template <typename Iterator>
+    bool unread_input(Scanner<Iterator>* s, uchar const*, int cnt)
+    {
+        if constexpr (std::bidirectional_iterator<Iterator>)
+        {
+            std::advance(s->act, -cnt);
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  The input for a Scanner<stream_input_ref> is read in chunks from the
+    //  underlying stream_input. Rewinding is limited to a few characters
+    //  which is all the backslash-newline handling in fill() needs.
+    inline int get_one_char(Scanner<stream_input_ref>* s)
+    {
+        return s->act->get();
+    }
+
+    inline std::ptrdiff_t rewind_stream(
+        Scanner<stream_input_ref>* s, [[maybe_unused]] int cnt)
+    {
+        RE2C_assert(cnt == -1);
+        s->act->unget();
+        return 0;
+    }
+
+    inline std::ptrdiff_t read_input(
+        Scanner<stream_input_ref>* s, uchar* dst, std::ptrdiff_t count)
+    {
+        return static_cast<std::ptrdiff_t>(s->act->read(
+            reinterpret_cast<char*>(dst), static_cast<std::size_t>(count)));
+    }
+
+    inline bool unread_input(
+        Scanner<stream_input_ref>* s, uchar const* chars, int cnt)
+    {
+        for (int i = cnt; i != 0; --i)
+            s->act->putback(static_cast<char>(chars[i - 1]));
+        return true;
+    }
+
+    //  The queues of the line splice offsets (and lengths) are created when
+    //  the first line splice is found, most inputs don't have any.
+    template <typename Iterator>
+    void enqueue_eol_offset(
+        Scanner<Iterator>* s, std::size_t offset, std::size_t length)
+    {
+        if (!s->eol_offsets)
+        {
+            s->eol_offsets = aq_create();
+            s->eol_lengths = aq_create();
+        }
+        aq_enqueue(s->eol_offsets, offset);
+        aq_enqueue(s->eol_lengths, length);
+    }
+
     template <typename Iterator>
     std::size_t get_first_eol_offset(Scanner<Iterator>* s)
     {
-        if (!AQ_EMPTY(s->eol_offsets))
+        if (s->eol_offsets && !AQ_EMPTY(s->eol_offsets))
         {
             return s->eol_offsets->queue[s->eol_offsets->head];
         }
@@ -100,12 +203,9 @@ namespace wave::cpplexer::re2clex {
     template <typename Iterator>
     void adjust_eol_offsets(Scanner<Iterator>* s, std::size_t adjustment)
     {
-        if (!s->eol_offsets)
-            s->eol_offsets = aq_create();
-
         aq_queue const q = s->eol_offsets;
 
-        if (AQ_EMPTY(q))
+        if (!q || AQ_EMPTY(q))
             return;
 
         std::size_t i = q->head;
@@ -136,7 +236,9 @@ namespace wave::cpplexer::re2clex {
         while (offset <= diff && offset != static_cast<unsigned int>(-1))
         {
             skipped++;
+            s->spliced += s->eol_lengths->queue[s->eol_lengths->head];
             aq_pop(s->eol_offsets);
+            aq_pop(s->eol_lengths);
             offset = get_first_eol_offset(s);
         }
         return skipped;
@@ -144,15 +246,64 @@ namespace wave::cpplexer::re2clex {
 
     bool is_backslash(const uchar* p, const uchar* end, int& len);
 
-#define WAVE_BSIZE 196608
+    ///////////////////////////////////////////////////////////////////////////////
+    //  add the line starts of the 'cnt' bytes just read into the buffer (and
+    //  of the line splices removed from them) to the line index
+    template <typename Iterator>
+    void record_line_starts(Scanner<Iterator>* s, std::ptrdiff_t cnt)
+    {
+        std::size_t const start = s->lim - s->bot;
+
+        // the queued line splices of this chunk are the last ones
+        std::vector<std::size_t> splices;
+        if (aq_queue const q = s->eol_offsets; nullptr != q)
+        {
+            for (std::size_t n = 0, i = q->head; n != q->size; ++n)
+            {
+                if (q->queue[i] >= start)
+                    splices.push_back(s->discarded + q->queue[i]);
+                if (++i == q->max_size)
+                    i = 0;
+            }
+        }
+
+        s->lines->add_chunk(s->lim, cnt, s->discarded + start, splices,
+            nullptr != s->eof);
+    }
+
+    //  The number of bytes to read at once: the input is read in chunks of
+    //  the configured buffer size (see scanner_buffer_options), if it is
+    //  shorter (and its size is known) the buffer is sized to fit, which
+    //  keeps lexing small snippets cheap. A short read marks the end of the
+    //  input.
+    template <typename Iterator>
+    std::ptrdiff_t read_size(Scanner<Iterator>* s)
+    {
+        auto const buffer_size = static_cast<std::ptrdiff_t>(
+            cpplexer::detail::scanner_buffer_size());
+        if constexpr (std::random_access_iterator<Iterator>)
+        {
+            // a few more bytes, the scanner may look beyond the end of the
+            // input (until it sees the terminating '\0')
+            if (std::ptrdiff_t const size = (s->last - s->act) + 16;
+                size < buffer_size)
+            {
+                return size;
+            }
+        }
+        return buffer_size;
+    }
+
     template <typename Iterator>
     uchar* fill(Scanner<Iterator>* s, uchar* cursor)
     {
         using namespace std;    // some systems have memcpy etc. in namespace std
         if (!s->eof)
         {
+            // the already consumed input is discarded, unless it is retained
+            // for lazily materialized token values
             std::ptrdiff_t cnt = s->tok - s->bot;
-            if (cnt)
+            if (cnt && nullptr == s->retained)
             {
                 if (NULL == s->lim)
                     s->lim = s->top;
@@ -164,13 +315,23 @@ namespace wave::cpplexer::re2clex {
                 s->ptr -= cnt;
                 cursor -= cnt;
                 s->lim -= cnt;
+                s->discarded += cnt;
                 adjust_eol_offsets(s, cnt);
             }
 
-            if ((s->top - s->lim) < WAVE_BSIZE)
+            std::ptrdiff_t const chunk = read_size(s);
+            if ((s->top - s->lim) < chunk)
             {
-                auto* buf = static_cast<uchar*>(
-                    malloc(((s->lim - s->bot) + WAVE_BSIZE) * sizeof(uchar)));
+                // grow the buffer geometrically, it holds the retained input
+                // or a token spanning several reads (i.e. a long comment or
+                // raw string literal)
+                std::ptrdiff_t size = (s->lim - s->bot) + chunk;
+                if (size < 2 * (s->top - s->bot))
+                    size = 2 * (s->top - s->bot);
+
+                auto capacity = static_cast<std::size_t>(size);
+                uchar* buf =
+                    cpplexer::detail::allocate_scanner_buffer(capacity);
                 if (buf == nullptr)
                 {
                     (*s->error_proc)(s, lexing_exception::unexpected_error,
@@ -181,40 +342,52 @@ namespace wave::cpplexer::re2clex {
                     return cursor;
                 }
 
-                if (size_t const length = s->lim - s->tok; length > 0)
+                if (size_t const length = s->lim - s->bot; length > 0)
                 {
-                    memmove(buf, s->tok, length);
+                    memmove(buf, s->bot, length);
                 }
-                s->tok = s->cur = buf;
+                s->tok = s->cur = &buf[s->tok - s->bot];
                 s->ptr = &buf[s->ptr - s->bot];
                 cursor = &buf[cursor - s->bot];
                 s->lim = &buf[s->lim - s->bot];
-                s->top = &s->lim[WAVE_BSIZE];
-                free(s->bot);
+                cpplexer::detail::release_scanner_buffer(
+                    s->bot, s->top - s->bot);
+                s->top = &buf[capacity];
                 s->bot = buf;
+                if (nullptr != s->retained)
+                {
+                    s->retained->data = buf;
+                    s->retained->capacity = capacity;
+                }
             }
 
-            cnt = std::distance(s->act, s->last);
-            if (cnt > WAVE_BSIZE)
-                cnt = WAVE_BSIZE;
-            uchar* dst = s->lim;
-            for (std::ptrdiff_t idx = 0; idx < cnt; ++idx)
-            {
-                *dst++ = *s->act++;
-            }
-
-            if (cnt != WAVE_BSIZE)
+            cnt = read_input(s, s->lim, chunk);
+            if (cnt != chunk)
             {
                 s->eof = &s->lim[cnt];
                 *(s->eof)++ = '\0';
             }
+            else
+            {
+                // a trigraph backslash ('??/') split by the end of the chunk
+                // is recognized in the next one
+                int trailing = 0;
+                while (trailing != 2 && s->lim[cnt - 1 - trailing] == '?')
+                    ++trailing;
+                if (trailing != 0 &&
+                    unread_input(s, s->lim + cnt - trailing, trailing))
+                {
+                    cnt -= trailing;
+                }
+            }
 
             /* backslash-newline erasing time */
 
             /* first scan for backslash-newline and erase them */
             for (uchar* p = s->lim; p < s->lim + cnt - 2; ++p)
             {
-                if (int len = 0; is_backslash(p, s->lim + cnt, len))
+                if (int len = 0; is_backslash(p, s->lim + cnt, len) &&
+                    p + len < s->lim + cnt)
                 {
                     if (*(p + len) == '\n')
                     {
@@ -222,61 +395,60 @@ namespace wave::cpplexer::re2clex {
                         memmove(p, p + offset, s->lim + cnt - p - offset);
                         cnt -= offset;
                         --p;
-                        aq_enqueue(s->eol_offsets, p - s->bot + 1);
+                        enqueue_eol_offset(s, p - s->bot + 1, offset);
                     }
-                    else if (*(p + len) == '\r')
+                    else if (*(p + len) == '\r' && p + len + 1 < s->lim + cnt)
                     {
-                        if (*(p + len + 1) == '\n')
-                        {
-                            int offset = len + 2;
-                            memmove(p, p + offset, s->lim + cnt - p - offset);
-                            cnt -= offset;
-                            --p;
-                        }
-                        else
-                        {
-                            int offset = len + 1;
-                            memmove(p, p + offset, s->lim + cnt - p - offset);
-                            cnt -= offset;
-                            --p;
-                        }
-                        aq_enqueue(s->eol_offsets, p - s->bot + 1);
+                        int const offset =
+                            (*(p + len + 1) == '\n') ? len + 2 : len + 1;
+                        memmove(p, p + offset, s->lim + cnt - p - offset);
+                        cnt -= offset;
+                        --p;
+                        enqueue_eol_offset(s, p - s->bot + 1, offset);
                     }
                 }
             }
 
-            /* FIXME: the following code should be fixed to recognize correctly the
-                  trigraph backslash token */
+            /* check to see if what we just read ends in a backslash (or in
+               its trigraph), the length of the one ending before 'pos' */
+            auto const backslash_before = [s](std::ptrdiff_t pos) -> int {
+                if (pos >= 1 && s->lim[pos - 1] == '\\')
+                    return 1;
+                if (pos >= 3 && s->lim[pos - 1] == '/' &&
+                    s->lim[pos - 2] == '?' && s->lim[pos - 3] == '?')
+                {
+                    return 3;
+                }
+                return 0;
+            };
 
-            /* check to see if what we just read ends in a backslash */
             if (cnt >= 2)
             {
                 uchar const last = s->lim[cnt - 1];
-                uchar const last2 = s->lim[cnt - 2];
                 /* check \ EOB */
-                if (last == '\\')
+                if (int const len = backslash_before(cnt); len != 0)
                 {
                     int const next = get_one_char(s);
                     /* check for \ \n or \ \r or \ \r \n straddling the border */
                     if (next == '\n')
                     {
-                        --cnt; /* chop the final \, we've already read the \n. */
-                        aq_enqueue(s->eol_offsets, cnt + (s->lim - s->bot));
+                        cnt -= len; /* chop the final \, we've already read the \n. */
+                        enqueue_eol_offset(
+                            s, cnt + (s->lim - s->bot), len + 1);
                     }
                     else if (next == '\r')
                     {
                         int const next2 = get_one_char(s);
-                        if (next2 == '\n')
-                        {
-                            --cnt; /* skip the backslash */
-                        }
-                        else
+                        int length = len + 2;
+                        if (next2 != '\n')
                         {
                             /* rewind one, and skip one char */
                             rewind_stream(s, -1);
-                            --cnt;
+                            length = len + 1;
                         }
-                        aq_enqueue(s->eol_offsets, cnt + (s->lim - s->bot));
+                        cnt -= len; /* skip the backslash */
+                        enqueue_eol_offset(
+                            s, cnt + (s->lim - s->bot), length);
                     }
                     else if (next != -1) /* -1 means end of file */
                     {
@@ -285,29 +457,31 @@ namespace wave::cpplexer::re2clex {
                     }
                 }
                 /* check \ \r EOB */
-                else if (last == '\r' && last2 == '\\')
+                else if (int const len_r = backslash_before(cnt - 1);
+                         last == '\r' && len_r != 0)
                 {
                     int const next = get_one_char(s);
-                    if (next == '\n')
-                    {
-                        cnt -= 2; /* skip the \ \r */
-                    }
-                    else
+                    int length = len_r + 2;
+                    if (next != '\n')
                     {
-                        /* rewind one, and skip two chars */
+                        /* rewind one, and skip the \ \r */
                         rewind_stream(s, -1);
-                        cnt -= 2;
+                        length = len_r + 1;
                     }
-                    aq_enqueue(s->eol_offsets, cnt + (s->lim - s->bot));
+                    cnt -= len_r + 1; /* skip the \ \r */
+                    enqueue_eol_offset(s, cnt + (s->lim - s->bot), length);
                 }
                 /* check \ \n EOB */
-                else if (last == '\n' && last2 == '\\')
+                else if (last == '\n' && len_r != 0)
                 {
-                    cnt -= 2;
-                    aq_enqueue(s->eol_offsets, cnt + (s->lim - s->bot));
+                    cnt -= len_r + 1;
+                    enqueue_eol_offset(s, cnt + (s->lim - s->bot), len_r + 1);
                 }
             }
 
+            if (nullptr != s->lines)
+                record_line_starts(s, cnt);
+
             s->lim += cnt;
             if (s->eof) /* eof needs adjusting if we erased backslash-newlines */
             {
@@ -317,41 +491,723 @@ namespace wave::cpplexer::re2clex {
         }
         return cursor;
     }
-#undef WAVE_BSIZE
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  skip_conditional_block
+    //
+    //      Skip the remaining lines of a conditional block without producing
+    //      tokens. The scanner has to be positioned at the beginning of a
+    //      line. Nested #if/#ifdef/#ifndef ... #endif blocks are skipped as a
+    //      whole, comments and literals are recognized (so that a directive
+    //      inside of them is not mistaken as such), everything else is only
+    //      looked at for newlines. Line splices have already been removed
+    //      from the buffer by fill(), they are accounted for in the line
+    //      numbers using count_backslash_newlines().
+    //
+    //      Returns the id of the directive terminating the block (T_PP_ELIF,
+    //      T_PP_ELSE, or T_PP_ENDIF) or T_EOF. The scanner is left in the
+    //      same state as if scan() had returned the directive token, i.e.
+    //      s->tok and s->cur enclose the directive up to and including its
+    //      keyword.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        constexpr bool is_identifier_char(uchar c) noexcept
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                (c >= '0' && c <= '9') || c == '_';
+        }
+
+        constexpr bool is_horizontal_space(uchar c) noexcept
+        {
+            return c == ' ' || c == '\t' || c == '\f' || c == '\v';
+        }
+    }    // namespace detail
+
+    template <typename Iterator>
+    token_id skip_conditional_block(Scanner<Iterator>* s)
+    {
+        uchar* p = s->cur;
+        std::size_t column = s->curr_column;
+
+        // make sure that 'n' characters are available starting at 'p'. The
+        // buffer contents starting at s->tok are preserved by fill().
+        auto need = [s, &p](std::ptrdiff_t n) {
+            if (s->lim - p < n && !s->eof)
+            {
+                s->line += count_backslash_newlines(s, p);
+                s->ptr = p;
+                p = fill(s, p);
+            }
+            return s->lim - p >= n;
+        };
+
+        auto newline = [s, &p, &column](std::ptrdiff_t length) {
+            p += length;
+            s->line += count_backslash_newlines(s, p) + 1;
+            column = 1;
+        };
+
+        // returns the length of the newline at 'p' (if any)
+        auto newline_length = [&p, &need]() -> std::ptrdiff_t {
+            if (*p == '\n')
+                return 1;
+            if (*p != '\r')
+                return 0;
+            return (need(2) && p[1] == '\n') ? 2 : 1;
+        };
+
+        // skip a '/* ... */' comment, 'p' refers to the opening '/'
+        auto skip_ccomment = [s, &p, &column, &need, &newline,
+                                 &newline_length](bool keep_token) {
+            p += 2;
+            column += 2;
+            while (true)
+            {
+                if (!keep_token)
+                    s->tok = p;
+                if (!need(2))
+                {
+                    column += s->lim - p;
+                    p = s->lim;
+                    return;
+                }
+                if (p[0] == '*' && p[1] == '/')
+                {
+                    p += 2;
+                    column += 2;
+                    return;
+                }
+                if (std::ptrdiff_t const len = newline_length(); len != 0)
+                {
+                    newline(len);
+                }
+                else
+                {
+                    ++p;
+                    ++column;
+                }
+            }
+        };
+
+        // skip a string or character literal up to the closing quote or the
+        // end of the line
+        auto skip_literal = [s, &p, &column, &need](uchar quote) {
+            ++p;
+            ++column;
+            while (true)
+            {
+                s->tok = p;
+                if (!need(2))
+                {
+                    column += s->lim - p;
+                    p = s->lim;
+                    return;
+                }
+                if (*p == quote)
+                {
+                    ++p;
+                    ++column;
+                    return;
+                }
+                if (*p == '\n' || *p == '\r')
+                    return;
+
+                std::ptrdiff_t const length = (*p == '\\') ? 2 : 1;
+                p += length;
+                column += length;
+            }
+        };
+
+        // skip a raw string literal, 'p' refers to the opening quote
+        auto skip_raw_string = [s, &p, &column, &need, &newline,
+                                   &newline_length]() -> bool {
+            s->tok = p;
+            need(18);
+
+            char delim[18];
+            std::ptrdiff_t delim_length = 0;
+            while (p + 1 + delim_length < s->lim && delim_length <= 16)
+            {
+                uchar const c = p[1 + delim_length];
+                if (c == '(')
+                    break;
+                if (c == ')' || c == '\\' || c == '"' || c == '\n' ||
+                    c == '\r' || detail::is_horizontal_space(c))
+                {
+                    return false;
+                }
+                delim[delim_length++] = static_cast<char>(c);
+            }
+            if (delim_length > 16 || p + 1 + delim_length >= s->lim)
+                return false;
+            delim[delim_length] = '"';
+
+            p += delim_length + 2;
+            column += delim_length + 2;
+            while (true)
+            {
+                s->tok = p;
+                if (!need(delim_length + 2))
+                {
+                    column += s->lim - p;
+                    p = s->lim;
+                    return true;
+                }
+                if (*p == ')' &&
+                    std::memcmp(p + 1, delim, delim_length + 1) == 0)
+                {
+                    p += delim_length + 2;
+                    column += delim_length + 2;
+                    return true;
+                }
+                if (std::ptrdiff_t const len = newline_length(); len != 0)
+                {
+                    newline(len);
+                }
+                else
+                {
+                    ++p;
+                    ++column;
+                }
+            }
+        };
+
+        int nesting = 0;
+        bool at_line_start = true;
+
+        // the first few characters of the current identifier or pp-number
+        uchar run[3] = {0, 0, 0};
+        std::size_t run_length = 0;
+
+        while (true)
+        {
+            s->tok = p;
+            if (!need(1))
+                break;
+
+            uchar c = *p;
+            if (at_line_start)
+            {
+                // white space and comments may precede a directive
+                if (detail::is_horizontal_space(c))
+                {
+                    ++p;
+                    ++column;
+                    continue;
+                }
+                if (c == '/' && need(2) && p[1] == '*')
+                {
+                    skip_ccomment(false);
+                    continue;
+                }
+
+                at_line_start = false;
+
+                // recognize '#', '%:', and '??='
+                need(3);
+                std::ptrdiff_t pound = 0;
+                if (c == '#')
+                    pound = 1;
+                else if (c == '%' && p + 1 < s->lim && p[1] == ':')
+                    pound = 2;
+                else if (c == '?' && p + 2 < s->lim && p[1] == '?' &&
+                    p[2] == '=')
+                {
+                    pound = 3;
+                }
+
+                if (pound != 0)
+                {
+                    // the directive text has to stay in the buffer
+                    s->line += count_backslash_newlines(s, p);
+                    std::size_t const line = s->line;
+                    std::size_t const pound_column = column;
+
+                    p += pound;
+                    column += pound;
+                    while (need(2))
+                    {
+                        if (detail::is_horizontal_space(*p))
+                        {
+                            ++p;
+                            ++column;
+                        }
+                        else if (p[0] == '/' && p[1] == '*')
+                        {
+                            skip_ccomment(true);
+                        }
+                        else
+                        {
+                            break;
+                        }
+                    }
+
+                    need(8);
+                    std::ptrdiff_t length = 0;
+                    while (p + length < s->lim && length < 7 &&
+                        detail::is_identifier_char(p[length]))
+                    {
+                        ++length;
+                    }
+                    if (p + length < s->lim &&
+                        detail::is_identifier_char(p[length]))
+                    {
+                        length = 0;    // not a directive we're looking for
+                    }
+
+                    std::string_view const directive(
+                        reinterpret_cast<char const*>(p), length);
+                    p += length;
+                    column += length;
+
+                    token_id id = T_EOF;
+                    if (directive == "if" || directive == "ifdef" ||
+                        directive == "ifndef")
+                    {
+                        ++nesting;
+                    }
+                    else if (directive == "endif")
+                    {
+                        if (nesting-- == 0)
+                            id = T_PP_ENDIF;
+                    }
+                    else if (nesting == 0)
+                    {
+                        if (directive == "else")
+                            id = T_PP_ELSE;
+                        else if (directive == "elif")
+                            id = T_PP_ELIF;
+                    }
+
+                    if (id != T_EOF)
+                    {
+                        s->line = line;
+                        s->column = pound_column;
+                        s->curr_column = column;
+                        s->cur = s->ptr = p;
+                        return id;
+                    }
+                    continue;
+                }
+            }
+
+            if (detail::is_identifier_char(c) || c == '.')
+            {
+                if (run_length < 3)
+                    run[run_length] = c;
+                ++run_length;
+                ++p;
+                ++column;
+                continue;
+            }
+
+            uchar const first = run[0];
+            bool const is_raw_prefix = s->act_in_cpp0x_mode &&
+                run_length != 0 && run_length <= 3 &&
+                run[run_length - 1] == 'R' &&
+                (run_length == 1 ||
+                    (run_length == 2 &&
+                        (first == 'u' || first == 'U' || first == 'L')) ||
+                    (run_length == 3 && first == 'u' && run[1] == '8'));
+            bool const in_number = run_length != 0 &&
+                ((first >= '0' && first <= '9') ||
+                    (first == '.' && run[1] >= '0' && run[1] <= '9'));
+            run_length = 0;
+
+            switch (c)
+            {
+            case '\n':
+            case '\r':
+                newline(newline_length());
+                at_line_start = true;
+                break;
+
+            case '"':
+                if (!is_raw_prefix || !skip_raw_string())
+                    skip_literal(c);
+                break;
+
+            case '\'':
+                if (in_number)
+                {
+                    // digit separator, the pp-number continues
+                    run_length = 1;
+                    run[0] = '0';
+                    ++p;
+                    ++column;
+                }
+                else
+                {
+                    skip_literal(c);
+                }
+                break;
+
+            case '/':
+                if (need(2) && p[1] == '*')
+                {
+                    skip_ccomment(false);
+                }
+                else if (p[1] == '/')
+                {
+                    // skip to the end of the line
+                    while (need(1) && *p != '\n' && *p != '\r')
+                    {
+                        s->tok = ++p;
+                        ++column;
+                    }
+                }
+                else
+                {
+                    ++p;
+                    ++column;
+                }
+                break;
+
+            default:
+                ++p;
+                ++column;
+                break;
+            }
+        }
+
+        // end of input reached
+        s->line += count_backslash_newlines(s, p);
+        s->tok = s->cur = s->ptr = p;
+        s->column = s->curr_column = column;
+        return T_EOF;
+    }
 
     ///////////////////////////////////////////////////////////////////////////////
     //  Special wrapper class holding the current cursor position
-    struct WAVE_DECL uchar_wrapper
+    struct uchar_wrapper
     {
-        uchar_wrapper(uchar* base_cursor, std::size_t column = 1);
+        explicit uchar_wrapper(uchar* base_cursor_, std::size_t column_ = 1)
+          : base_cursor(base_cursor_)
+          , column(column_)
+        {
+        }
 
-        uchar_wrapper& operator++();
+        uchar_wrapper& operator++()
+        {
+            ++base_cursor;
+            ++column;
+            return *this;
+        }
 
-        uchar_wrapper& operator--();
+        uchar_wrapper& operator--()
+        {
+            --base_cursor;
+            --column;
+            return *this;
+        }
 
-        uchar operator*() const;
+        uchar operator*() const
+        {
+            return *base_cursor;
+        }
 
-        operator uchar*() const;
+        operator uchar*() const
+        {
+            return base_cursor;
+        }
 
-        friend WAVE_DECL std::ptrdiff_t operator-(
-            uchar_wrapper const& lhs, uchar_wrapper const& rhs);
+        friend std::ptrdiff_t operator-(
+            uchar_wrapper const& lhs, uchar_wrapper const& rhs)
+        {
+            return lhs.base_cursor - rhs.base_cursor;
+        }
 
         uchar* base_cursor;
         std::size_t column;
     };
 
     ///////////////////////////////////////////////////////////////////////////////
-    template <typename Iterator>
+    //  The scanner is instantiated for two cursor types: uchar_wrapper keeps
+    //  track of the column of the cursor, a plain uchar* does not (the
+    //  columns stored in the Scanner are not updated in this case).
+    template <typename Cursor>
+    Cursor make_cursor(uchar* p, std::size_t column);
+
+    template <>
+    inline uchar_wrapper make_cursor<uchar_wrapper>(
+        uchar* p, std::size_t column)
+    {
+        return uchar_wrapper(p, column);
+    }
+
+    template <>
+    inline uchar* make_cursor<uchar*>(uchar* p, std::size_t)
+    {
+        return p;
+    }
+
+    // move the cursor, keeping its column
+    inline void set_cursor(uchar_wrapper& cursor, uchar* p)
+    {
+        cursor.base_cursor = p;
+    }
+
+    inline void set_cursor(uchar*& cursor, uchar* p)
+    {
+        cursor = p;
+    }
+
+    inline void set_column(uchar_wrapper& cursor, std::size_t column)
+    {
+        cursor.column = column;
+    }
+
+    inline void set_column(uchar*&, std::size_t) {}
+
+    inline void store_column(std::size_t& column, uchar_wrapper const& cursor)
+    {
+        column = cursor.column;
+    }
+
+    inline void store_column(std::size_t&, uchar*) {}
+
+    inline std::size_t get_column(uchar_wrapper const& cursor)
+    {
+        return cursor.column;
+    }
+
+    inline std::size_t get_column(uchar*)
+    {
+        return 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  skip_comment_text
+    //
+    //      Advance the cursor over the text of a comment up to the next
+    //      character the comment states of the scanner have to look at: the
+    //      given stop character ('*' for a C comment), a newline, or any
+    //      other control character (including the '\0' at the end of the
+    //      input), but a tab. Stops at the limit as well, the scanner
+    //      refills the buffer as usual. Line splices (including the trigraph
+    //      ones) were already removed from the buffer by fill().
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        constexpr bool is_comment_special(uchar c, uchar stop) noexcept
+        {
+            return c == stop || (c < 040 && c != '\t');
+        }
+
+        inline uchar* find_comment_special(
+            uchar* p, uchar* end, uchar stop) noexcept
+        {
+#if WAVE_USE_SSE2
+            __m128i const stops = _mm_set1_epi8(static_cast<char>(stop));
+            __m128i const controls = _mm_set1_epi8(037);
+            __m128i const tabs = _mm_set1_epi8('\t');
+            __m128i const zero = _mm_setzero_si128();
+
+            for (/**/; end - p >= 16; p += 16)
+            {
+                __m128i const chunk =
+                    _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+
+                // c <= 037 (unsigned) is equivalent to saturated c - 037 == 0
+                __m128i const is_control =
+                    _mm_cmpeq_epi8(_mm_subs_epu8(chunk, controls), zero);
+                __m128i const is_special =
+                    _mm_or_si128(_mm_cmpeq_epi8(chunk, stops),
+                        _mm_andnot_si128(
+                            _mm_cmpeq_epi8(chunk, tabs), is_control));
+
+                if (int const mask = _mm_movemask_epi8(is_special); mask != 0)
+                {
+                    return p +
+                        std::countr_zero(static_cast<unsigned int>(mask));
+                }
+            }
+#endif
+            while (p != end && !is_comment_special(*p, stop))
+                ++p;
+            return p;
+        }
+    }    // namespace detail
+
+    template <typename Cursor>
+    void skip_comment_text(Cursor& cursor, uchar* limit, uchar stop)
+    {
+        uchar* const p = cursor;
+        uchar* const q = detail::find_comment_special(p, limit, stop);
+        set_column(cursor, get_column(cursor) + (q - p));
+        set_cursor(cursor, q);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  scan_raw_string
+    //
+    //      Scan the remainder of a raw string literal, the cursor refers to
+    //      the character following the opening double quote. The delimiter
+    //      is not copied, it is referred to by its offset from s->tok (the
+    //      buffer contents starting at s->tok are preserved by fill()). The
+    //      candidates for the closing ')' are located using memchr, the
+    //      characters in between are looked at for newlines and invalid
+    //      characters only.
+    //
+    //      Returns T_RAWSTRINGLIT, or an UnknownTokenType for an invalid
+    //      character (after having reported it). On return the cursor
+    //      refers to the character following the literal.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename Cursor, typename Iterator>
+    token_id scan_raw_string(Scanner<Iterator>* s, Cursor& cursor)
+    {
+        uchar* p = cursor;
+        std::size_t column = get_column(cursor);
+
+        // make sure that 'n' characters are available starting at 'p'
+        auto need = [s, &p](std::ptrdiff_t n) {
+            if (s->lim - p < n && !s->eof)
+            {
+                s->line += count_backslash_newlines(s, p);
+                s->ptr = p;
+                p = fill(s, p);
+            }
+            return s->lim - p >= n;
+        };
+
+        auto finish = [&](token_id id) {
+            set_cursor(cursor, p);
+            set_column(cursor, column);
+            return id;
+        };
+
+        // the delimiter: any character but parentheses, backslash, and
+        // whitespace
+        std::ptrdiff_t const delim_offset = p - s->tok;
+        while (true)
+        {
+            need(1);
+            uchar const c = *p;    // the end of the input is a '\0'
+            if (c == '(')
+                break;
+
+            ++p;
+            ++column;
+            if (c < 040 || c == ')' || c == '\\')
+            {
+                (*s->error_proc)(s, lexing_exception::generic_lexing_error,
+                    "Invalid character in raw string delimiter ('%c')", c);
+
+                // the error was reported to an error sink
+                return finish(TOKEN_FROM_ID(*s->tok, UnknownTokenType));
+            }
+
+            if (p - s->tok - delim_offset == 17)
+            {
+                (*s->error_proc)(s, lexing_exception::generic_lexing_error,
+                    "Raw string delimiter of excessive length (\"%.*s\") in "
+                    "input stream",
+                    17, s->tok + delim_offset);
+            }
+        }
+
+        std::ptrdiff_t const delim_length = p - s->tok - delim_offset;
+        ++p;    // '('
+        ++column;
+
+        // the body
+        while (true)
+        {
+            if (p == s->lim && !need(1))
+            {
+                // unterminated literal, *p is the terminating '\0'
+                ++p;
+                ++column;
+                (*s->error_proc)(s, lexing_exception::generic_lexing_error,
+                    "Invalid character in raw string body ('%c')", '\0');
+                return finish(TOKEN_FROM_ID(*s->tok, UnknownTokenType));
+            }
+
+            uchar* const lim = s->lim;
+            auto* const rparen =
+                static_cast<uchar*>(std::memchr(p, ')', lim - p));
+            uchar* const end = rparen ? rparen : lim;
+
+            // account for the characters up to the next candidate
+            for (/**/; p != end; ++p)
+            {
+                uchar const c = *p;
+                if (c >= 040 || c == '\t' || c == '\v' || c == '\f')
+                {
+                    ++column;
+                }
+                else if (c == '\n')
+                {
+                    s->line += count_backslash_newlines(s, p) + 1;
+                    column = 1;
+                }
+                else if (c == '\r')
+                {
+                    if (p + 1 == lim && !s->eof)
+                        break;    // decide once more input is available
+
+                    if (p[1] == '\n')
+                    {
+                        ++column;    // counted at the '\n'
+                    }
+                    else
+                    {
+                        s->line += count_backslash_newlines(s, p) + 1;
+                        column = 1;
+                    }
+                }
+                else
+                {
+                    ++p;
+                    ++column;
+                    (*s->error_proc)(s,
+                        lexing_exception::generic_lexing_error,
+                        "Invalid character in raw string body ('%c')", c);
+
+                    // the error was reported to an error sink
+                    return finish(TOKEN_FROM_ID(*s->tok, UnknownTokenType));
+                }
+            }
+
+            if (p != end)
+            {
+                need(2);    // a '\r' at the end of the buffer
+                continue;
+            }
+            if (rparen == nullptr)
+                continue;
+
+            // p refers to a ')', check whether it is followed by the
+            // delimiter and a double quote
+            if (need(delim_length + 2) && p[delim_length + 1] == '"' &&
+                std::memcmp(p + 1, s->tok + delim_offset, delim_length) == 0)
+            {
+                p += delim_length + 2;
+                column += delim_length + 2;
+                return finish(T_RAWSTRINGLIT);
+            }
+            ++p;
+            ++column;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename Cursor, typename Iterator>
     token_id scan(Scanner<Iterator>* s)
     {
         assert(0 != s->error_proc);    // error handler must be given
 
-        uchar_wrapper cursor(s->tok = s->cur, s->column = s->curr_column);
-        uchar_wrapper marker(s->ptr);
-        uchar_wrapper limit(s->lim);
-
-        using string_type = WAVE_STRINGTYPE;
-        string_type rawstringdelim;    // for use with C++11 raw string literals
+        Cursor cursor =
+            make_cursor<Cursor>(s->tok = s->cur, s->column = s->curr_column);
+        Cursor marker = make_cursor<Cursor>(s->ptr, 1);
+        Cursor limit = make_cursor<Cursor>(s->lim, 1);
 
 // include the correct Re2C token definition rules
 #if (defined(__FreeBSD__) || defined(__DragonFly__) ||                         \
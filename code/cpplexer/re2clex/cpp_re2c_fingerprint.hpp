@@ -0,0 +1,54 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "../config.hpp"
+#include "../language_support.hpp"
+#include "../token_fingerprint.hpp"
+#include "../token_ids.hpp"
+#include "cpp_re.hpp"
+#include "cpp_re2c_visit.hpp"
+#include "scanner.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename IteratorT, typename PositionT>
+    token_fingerprint token_fingerprint_gen<IteratorT, PositionT>::fingerprint(
+        IteratorT const& first, IteratorT const& last, PositionT const& pos,
+        language_support language,
+        std::vector<declaration_fingerprint>* declarations)
+    {
+        using namespace re2clex;
+
+        auto const filename = pos.get_file();
+
+        Scanner<IteratorT> scanner(first, last);
+        start_scanner(scanner, pos, filename.c_str(), language, nullptr);
+
+        fingerprint_builder builder(declarations);
+
+        // the line after the current token is the line of its last
+        // character (see visit_tokens)
+        auto visit = [&](token_id id, std::string_view value,
+                         std::size_t line, std::size_t) {
+            builder.add(id, value, line, scanner.line);
+        };
+
+        // the columns are not needed
+        visit_tokens<uchar*>(scanner, visit);
+        return builder.finalize();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
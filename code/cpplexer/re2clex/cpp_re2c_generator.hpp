@@ -0,0 +1,40 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../config.hpp"
+#include "../error_sink.hpp"
+#include "../language_support.hpp"
+#include "../token_generator.hpp"
+#include "../token_ids.hpp"
+#include "../token_value_buffer.hpp"
+#include "cpp_re2c_lexer.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename IteratorT, typename PositionT, typename TokenT>
+    generator<TokenT> generate_tokens(IteratorT first, IteratorT last,
+        PositionT pos, language_support language, error_sink* errors,
+        token_value_buffer* values)
+    {
+        re2clex::lexer<IteratorT, PositionT, TokenT> lexer(
+            first, last, pos, language);
+        lexer.set_error_sink(errors);
+        if (nullptr != values)
+            lexer.set_value_buffer(values);
+
+        TokenT token;
+        do
+        {
+            co_yield lexer.get(token);
+        } while (T_EOF != token_id(token));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
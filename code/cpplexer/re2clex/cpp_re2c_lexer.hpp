@@ -12,23 +12,34 @@
 
 #pragma once
 
+#include <array>
 #include <cstdarg>
+#include <cstdint>
 #include <cstdio>
+#include <limits>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 #include <cassert>
 
+#include "../checkpoint_index.hpp"
 #include "../config.hpp"
 #include "../convert_trigraphs.hpp"
 #include "../cpp_lex_interface.hpp"
 #include "../cpp_lex_interface_generator.hpp"
 #include "../cpplexer_exceptions.hpp"
+#include "../detect_include_guards.hpp"
+#include "../error_sink.hpp"
 #include "../file_position.hpp"
+#include "../identifier_interner.hpp"
 #include "../language_support.hpp"
+#include "../line_index.hpp"
+#include "../numeric_literal.hpp"
 #include "../re2clex/cpp_re.hpp"
 #include "../re2clex/scanner.hpp"
-#include "../token_cache.hpp"
 #include "../token_ids.hpp"
+#include "../token_value_buffer.hpp"
 #include "../validate_universal_char.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -36,6 +47,113 @@ namespace wave::cpplexer {
 
     namespace re2clex {
 
+        ///////////////////////////////////////////////////////////////////////////////
+        //  configure the scanner for the given language
+        template <typename IteratorT>
+        void configure_scanner(
+            Scanner<IteratorT>& scanner, language_support language)
+        {
+            scanner.enable_ms_extensions = false;
+
+#if WAVE_SUPPORT_VARIADICS_PLACEMARKERS != 0
+            scanner.act_in_c99_mode = need_c99(language);
+#endif
+
+            scanner.enable_import_keyword = false;
+
+            scanner.detect_pp_numbers = need_prefer_pp_numbers(language);
+            scanner.single_line_only = need_single_line(language);
+
+#if WAVE_SUPPORT_CPP0X != 0
+            scanner.act_in_cpp0x_mode = need_cpp0x(language);
+#else
+            scanner.act_in_cpp0x_mode = false;
+#endif
+
+#if WAVE_SUPPORT_CPP2A != 0
+            scanner.act_in_cpp2a_mode = need_cpp2a(language);
+            scanner.act_in_cpp0x_mode =
+                need_cpp2a(language) || need_cpp0x(language);
+#else
+            scanner.act_in_cpp2a_mode = false;
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        //  the processing required to create a token of a given id
+        enum class token_action : std::uint8_t
+        {
+            text,          // the value is the token text
+            fixed,         // the value is the fixed value of the token id
+            identifier,    // token text, validate universal characters
+            literal,       // token text, convert trigraphs, validate
+            number,        // token text, decode the numeric literal
+            include,       // token text, detect #include_next
+            long_long,     // token text, check long long support, decode
+            trigraph,      // token text or the converted trigraph
+            eof            // empty value, end of input
+        };
+
+        namespace detail {
+
+            inline constexpr std::size_t token_action_count =
+                T_LAST_TOKEN - T_FIRST_TOKEN;
+
+            constexpr std::array<token_action, token_action_count>
+            make_token_actions() noexcept
+            {
+                // all keywords, operators, and preprocessor directives have
+                // a fixed value
+                std::array<token_action, token_action_count> actions{};
+                for (token_action& action : actions)
+                    action = token_action::fixed;
+
+                auto set = [&](token_id id, token_action action) {
+                    actions[BASEID_FROM_TOKEN(id) - T_FIRST_TOKEN] = action;
+                };
+
+                set(T_IDENTIFIER, token_action::identifier);
+                set(T_STRINGLIT, token_action::literal);
+                set(T_CHARLIT, token_action::literal);
+                set(T_RAWSTRINGLIT, token_action::literal);
+                set(T_PP_HHEADER, token_action::include);
+                set(T_PP_QHEADER, token_action::include);
+                set(T_PP_INCLUDE, token_action::include);
+                set(T_LONGINTLIT, token_action::long_long);
+                set(T_EOF, token_action::eof);
+
+                for (token_id id : {T_OCTALINT, T_DECIMALINT, T_HEXAINT,
+                         T_INTLIT, T_FLOATLIT, T_PP_NUMBER})
+                {
+                    set(id, token_action::number);
+                }
+                for (token_id id : {T_SPACE, T_SPACE2, T_ANY})
+                    set(id, token_action::text);
+                return actions;
+            }
+
+            inline constexpr std::array<token_action, token_action_count>
+                token_actions = make_token_actions();
+        }    // namespace detail
+
+        ///////////////////////////////////////////////////////////////////////////////
+        //  Tokens with an extended category (alternative tokens, comments,
+        //  trigraphs) have their text as their value (trigraphs may need to
+        //  be converted), all others are looked up by their base id.
+        constexpr token_action get_token_action(token_id id) noexcept
+        {
+            if (0 != (id & ExtTokenOnlyMask))
+            {
+                return 0 != (id & TriGraphTokenType) ? token_action::trigraph :
+                                                       token_action::text;
+            }
+
+            std::size_t const index = BASEID_FROM_TOKEN(id) - T_FIRST_TOKEN;
+            return index < detail::token_actions.size() ?
+                detail::token_actions[index] :
+                token_action::text;
+        }
+
         ///////////////////////////////////////////////////////////////////////////////
         //
         //  encapsulation of the re2c based cpp lexer
@@ -43,7 +161,7 @@ namespace wave::cpplexer {
         ///////////////////////////////////////////////////////////////////////////////
 
         template <typename IteratorT,
-            typename PositionT = util::file_position_type,
+            typename PositionT = wave::util::file_position_type,
             typename TokenT = lex_token<PositionT>>
         class lexer
         {
@@ -53,9 +171,15 @@ namespace wave::cpplexer {
 
             lexer(IteratorT const& first, IteratorT const& last,
                 PositionT const& pos, language_support language_);
-            ~lexer();
+
+            // lex the given input, the buffers of the scanner are kept. The
+            // tokens referring to the previous input (lazy token values) are
+            // invalid afterwards.
+            void reset(IteratorT const& first, IteratorT const& last,
+                PositionT const& pos, language_support language_);
 
             token_type& get(token_type&);
+            token_type& skip_to_matching_conditional(token_type&);
             void set_position(PositionT const& pos)
             {
                 // set position has to change the file name and line number only
@@ -65,11 +189,85 @@ namespace wave::cpplexer {
                 scanner.file_name = filename.c_str();
             }
 
+            // the include guard detection is active only if enabled by the
+            // language options
+            void set_include_guards(include_guards<token_type>* guards_)
+            {
+                guards = guards_;
+            }
+
+            // the lexer input is retained in the given buffer only if lazy
+            // token values are enabled by the language options, this has to
+            // be done before the first token is read (the buffer takes over
+            // the memory already allocated by the scanner)
+            void set_value_buffer(token_value_buffer* buffer)
+            {
+                assert(scanner.cur == scanner.bot);
+                if (need_lazy_token_values(language) &&
+                    scanner.retained != buffer)
+                {
+                    if (nullptr != scanner.retained)
+                    {
+                        scanner.retained->data = nullptr;
+                        scanner.retained->capacity = 0;
+                    }
+                    buffer->reset();
+                    buffer->data = scanner.bot;
+                    buffer->capacity = scanner.top - scanner.bot;
+                    scanner.retained = buffer;
+                }
+            }
+
+            // the line starts of the input are recorded in the given index,
+            // this has to be done before the first token is read
+            void set_line_index(line_index* lines)
+            {
+                assert(scanner.cur == scanner.bot);
+                lines->clear();
+                scanner.lines = lines;
+            }
+
+            // the diagnostics are reported to the given sink instead of being
+            // thrown, the lexer continues after each of them
+            void set_error_sink(error_sink* errors)
+            {
+                scanner.errors = errors;
+            }
+
+            // checkpoints are recorded in the given index while lexing, this
+            // has to be done before the first token is read
+            void set_checkpoint_index(checkpoint_index* index)
+            {
+                assert(scanner.cur == scanner.bot);
+                checkpoints = index;
+                if (nullptr != checkpoints)
+                    start_checkpoints();
+            }
+
+            // the identifiers are interned by the given interner, their ids
+            // are stored in the tokens
+            void set_identifier_interner(identifier_interner* interner_)
+            {
+                interner = interner_;
+            }
+
             // error reporting from the re2c generated lexer
             static int report_error(
                 Scanner<IteratorT> const* s, int errcode, char const*, ...);
 
         private:
+            // the columns are tracked only if the position type has one
+            using cursor_type =
+                std::conditional_t<wave::util::has_column<PositionT>::value,
+                    uchar_wrapper, uchar*>;
+
+            token_type make_token(token_id id, std::size_t line,
+                bool convert = false,
+                interned_identifier const& identifier = {});
+
+            void start_checkpoints();
+            void record_checkpoint();
+
             static char const* tok_names[];
 
             Scanner<IteratorT> scanner;
@@ -77,7 +275,9 @@ namespace wave::cpplexer {
             string_type value;
             bool at_eof;
             language_support language;
-            static token_cache<string_type> const cache;
+            include_guards<token_type>* guards = nullptr;
+            checkpoint_index* checkpoints = nullptr;
+            identifier_interner* interner = nullptr;
         };
 
         ///////////////////////////////////////////////////////////////////////////////
@@ -91,43 +291,68 @@ namespace wave::cpplexer {
           , at_eof(false)
           , language(language_)
         {
-            using namespace std;    // some systems have memset in std
-
             scanner.line = pos.get_line();
             scanner.column = scanner.curr_column = pos.get_column();
             scanner.error_proc = report_error;
             scanner.file_name = filename.c_str();
-            scanner.enable_ms_extensions = false;
-
-#if WAVE_SUPPORT_VARIADICS_PLACEMARKERS != 0
-            scanner.act_in_c99_mode = need_c99(language_);
-#endif
+            configure_scanner(scanner, language_);
+        }
 
-            scanner.enable_import_keyword = false;
+        template <typename IteratorT, typename PositionT, typename TokenT>
+        void lexer<IteratorT, PositionT, TokenT>::reset(IteratorT const& first,
+            IteratorT const& last, PositionT const& pos,
+            language_support language_)
+        {
+            scanner.reset(first, last);
+            filename = pos.get_file();
+            at_eof = false;
+            language = language_;
 
-            scanner.detect_pp_numbers = need_prefer_pp_numbers(language_);
-            scanner.single_line_only = need_single_line(language_);
+            scanner.line = pos.get_line();
+            scanner.column = scanner.curr_column = pos.get_column();
+            scanner.file_name = filename.c_str();
+            configure_scanner(scanner, language_);
 
-#if WAVE_SUPPORT_CPP0X != 0
-            scanner.act_in_cpp0x_mode = need_cpp0x(language_);
-#else
-            scanner.act_in_cpp0x_mode = false;
-#endif
+            // the scanner owns its buffer again, if lazy token values are not
+            // enabled anymore
+            if (nullptr != scanner.retained &&
+                !need_lazy_token_values(language_))
+            {
+                scanner.retained->data = nullptr;
+                scanner.retained->capacity = 0;
+                scanner.retained = nullptr;
+            }
+            if (nullptr != scanner.lines)
+                scanner.lines->clear();
+            if (nullptr != checkpoints)
+                start_checkpoints();
+        }
 
-#if WAVE_SUPPORT_CPP2A != 0
-            scanner.act_in_cpp2a_mode = need_cpp2a(language_);
-            scanner.act_in_cpp0x_mode =
-                need_cpp2a(language_) || need_cpp0x(language_);
-#else
-            scanner.act_in_cpp2a_mode = false;
-#endif
+        ///////////////////////////////////////////////////////////////////////////////
+        //  the start of the input is the first checkpoint
+        template <typename IteratorT, typename PositionT, typename TokenT>
+        void lexer<IteratorT, PositionT, TokenT>::start_checkpoints()
+        {
+            checkpoints->clear(language,
+                lexer_checkpoint{0, scanner.line, scanner.curr_column});
         }
 
+        //  record a checkpoint after the current token if one is due, the
+        //  offset of the next character in the input is its offset in the
+        //  line splice free buffer plus the size of the line splices passed
         template <typename IteratorT, typename PositionT, typename TokenT>
-        lexer<IteratorT, PositionT, TokenT>::~lexer()
+        void lexer<IteratorT, PositionT, TokenT>::record_checkpoint()
         {
-            using namespace std;    // some systems have free in std
-            free(scanner.bot);
+            if (scanner.cur > scanner.lim)
+                return;
+
+            std::size_t const offset = scanner.discarded +
+                (scanner.cur - scanner.bot) + scanner.spliced;
+            if (checkpoints->is_due(offset))
+            {
+                checkpoints->add(lexer_checkpoint{
+                    offset, scanner.line, scanner.curr_column});
+            }
         }
 
         ///////////////////////////////////////////////////////////////////////////////
@@ -139,138 +364,205 @@ namespace wave::cpplexer {
                 return result = token_type();    // return T_EOI
 
             std::size_t actline = scanner.line;
-            auto id = static_cast<token_id>(scan(&scanner));
+            auto id = static_cast<token_id>(scan<cursor_type>(&scanner));
+            if (nullptr != checkpoints)
+                record_checkpoint();
+
+            // most tokens have their text as their value, 'value' is used for
+            // the others only
+            std::string_view const text(
+                (char const*) scanner.tok, scanner.cur - scanner.tok);
+            bool has_text_value = true;
+            bool convert = false;
+            interned_identifier identifier;
+            numeric_literal number;
+
+            switch (get_token_action(id))
+            {
+            case token_action::text:
+                break;
 
-            switch (id)
+            case token_action::number:
+                if (need_decode_numeric_literals(language))
+                    number = decode_numeric_literal(text);
+                break;
+
+            case token_action::fixed:
+                value = get_token_value_view(id);
+                has_text_value = false;
+                break;
+
+            case token_action::identifier:
             {
-            case T_IDENTIFIER:
+                // the hash for the interner is computed in the same pass
+                // looking for universal character names
+                bool has_ucn = false;
+                if (nullptr != interner)
+                {
+                    std::uint32_t hash = identifier_hash_seed;
+                    for (char c : text)
+                    {
+                        hash = hash_identifier_char(hash, c);
+                        has_ucn |= (c == '\\');
+                    }
+                    identifier.interner = interner;
+                    identifier.id = interner->intern(text, hash);
+                }
+                else
+                {
+                    has_ucn = text.find('\\') != std::string_view::npos;
+                }
+
                 // test identifier characters for validity (throws if invalid chars found)
-                value = string_type(
-                    (char const*) scanner.tok, scanner.cur - scanner.tok);
-                if (!need_no_character_validation(language))
-                    impl::validate_identifier_name(
-                        value, actline, scanner.column, filename);
+                if (has_ucn && !need_no_character_validation(language))
+                {
+                    impl::validate_identifier_name(string_type(text),
+                        actline, scanner.column, filename, scanner.errors);
+                }
                 break;
+            }
 
-            case T_STRINGLIT:
-            case T_CHARLIT:
-            case T_RAWSTRINGLIT:
+            case token_action::literal:
                 // test literal characters for validity (throws if invalid chars found)
-                value = string_type(
-                    (char const*) scanner.tok, scanner.cur - scanner.tok);
-                if (need_convert_trigraphs(language))
-                    value = impl::convert_trigraphs(value);
-                if (!need_no_character_validation(language))
-                    impl::validate_literal(
-                        value, actline, scanner.column, filename);
+                convert = need_convert_trigraphs(language) &&
+                    text.find('?') != std::string_view::npos;
+                if (!need_no_character_validation(language) &&
+                    (text.find('\\') != std::string_view::npos ||
+                        (convert &&
+                            text.find("?\?/") != std::string_view::npos)))
+                {
+                    value = string_type(text);
+                    if (convert)
+                        value = impl::convert_trigraphs(value);
+                    impl::validate_literal(value, actline, scanner.column,
+                        filename, scanner.errors);
+                    has_text_value = false;
+                }
                 break;
 
-            case T_PP_HHEADER:
-            case T_PP_QHEADER:
-            case T_PP_INCLUDE:
+            case token_action::include:
                 // convert to the corresponding ..._next token, if appropriate
                 {
-                    value = string_type(
-                        (char const*) scanner.tok, scanner.cur - scanner.tok);
-
 #if WAVE_SUPPORT_INCLUDE_NEXT != 0
                     // Skip '#' and whitespace and see whether we find an 'include_next' here.
-                    typename string_type::size_type start =
-                        value.find("include");
-                    if (value.compare(start, 12, "include_next", 12) == 0)
+                    std::string_view::size_type const start =
+                        text.find("include");
+                    if (text.compare(start, 12, "include_next") == 0)
                         id = static_cast<token_id>(id | AltTokenType);
 #endif
                     break;
                 }
 
-            case T_LONGINTLIT:    // supported in C++11, C99 and long_long mode
-                value = string_type(
-                    (char const*) scanner.tok, scanner.cur - scanner.tok);
+            case token_action::long_long:
+                // supported in C++11, C99 and long_long mode
                 if (!need_long_long(language))
                 {
                     // syntax error: not allowed in C++ mode
-                    WAVE_LEXER_THROW(lexing_exception,
-                        invalid_long_long_literal, value.c_str(), actline,
-                        scanner.column, filename.c_str());
+                    report_lexing_error(scanner.errors,
+                        lexing_exception::invalid_long_long_literal, text,
+                        actline, scanner.column, filename.c_str());
                 }
+                if (need_decode_numeric_literals(language))
+                    number = decode_numeric_literal(text);
                 break;
 
-            case T_OCTALINT:
-            case T_DECIMALINT:
-            case T_HEXAINT:
-            case T_INTLIT:
-            case T_FLOATLIT:
-            case T_FIXEDPOINTLIT:
-            case T_CCOMMENT:
-            case T_CPPCOMMENT:
-            case T_SPACE:
-            case T_SPACE2:
-            case T_ANY:
-            case T_PP_NUMBER:
-                value = string_type(
-                    (char const*) scanner.tok, scanner.cur - scanner.tok);
+            case token_action::trigraph:
+                if (need_convert_trigraphs(language))
+                {
+                    if (T_ANY_TRIGRAPH == id)
+                        value = impl::convert_trigraph(string_type(text));
+                    else
+                        value = get_token_value_view(id);
+                    has_text_value = false;
+                }
                 break;
 
-            case T_EOF:
+            case token_action::eof:
                 // T_EOF is returned as a valid token, the next call will return T_EOI,
                 // i.e. the actual end of input
                 at_eof = true;
                 value.clear();
+                has_text_value = false;
                 break;
+            }
 
-            case T_OR_TRIGRAPH:
-            case T_XOR_TRIGRAPH:
-            case T_LEFTBRACE_TRIGRAPH:
-            case T_RIGHTBRACE_TRIGRAPH:
-            case T_LEFTBRACKET_TRIGRAPH:
-            case T_RIGHTBRACKET_TRIGRAPH:
-            case T_COMPL_TRIGRAPH:
-            case T_POUND_TRIGRAPH:
-                if (need_convert_trigraphs(language))
-                {
-                    value = cache.get_token_value(BASEID_FROM_TOKEN(id));
-                }
-                else
-                {
-                    value = string_type(
-                        (char const*) scanner.tok, scanner.cur - scanner.tok);
-                }
-                break;
+            // the re2c lexer reports the new line number for newline tokens
+            if (has_text_value)
+            {
+                result = make_token(id, actline, convert, identifier);
+            }
+            else
+            {
+                result = token_type(
+                    id, value, PositionT(filename, actline, scanner.column));
+            }
+            if (number.kind != numeric_literal_kind::none)
+                result.set_numeric_literal(number);
 
-            case T_ANY_TRIGRAPH:
-                if (need_convert_trigraphs(language))
-                {
-                    value = impl::convert_trigraph(
-                        string_type((char const*) scanner.tok));
-                }
-                else
-                {
-                    value = string_type(
-                        (char const*) scanner.tok, scanner.cur - scanner.tok);
-                }
-                break;
+            if (guards != nullptr && need_include_guard_detection(language))
+                return guards->detect_guard(result);
+            return result;
+        }
 
-            default:
-                if (CATEGORY_FROM_TOKEN(id) != EXTCATEGORY_FROM_TOKEN(id) ||
-                    IS_CATEGORY(id, UnknownTokenType))
-                {
-                    value = string_type(
-                        (char const*) scanner.tok, scanner.cur - scanner.tok);
-                }
-                else
-                {
-                    value = cache.get_token_value(id);
-                }
-                break;
-            }
+        ///////////////////////////////////////////////////////////////////////////////
+        //  skip the remaining lines of a conditional block (the lexer has to be
+        //  positioned at the beginning of a line), returns the #elif, #else, or
+        //  #endif token terminating the block
+        template <typename IteratorT, typename PositionT, typename TokenT>
+        TokenT& lexer<IteratorT, PositionT, TokenT>::skip_to_matching_conditional(
+            TokenT& result)
+        {
+            if (at_eof)
+                return result = token_type();    // return T_EOI
 
-            // the re2c lexer reports the new line number for newline tokens
-            result = token_type(
-                id, value, PositionT(filename, actline, scanner.column));
+            token_id const id = skip_conditional_block(&scanner);
+            if (id == T_EOF)
+            {
+                at_eof = true;
+                value.clear();
+                result = token_type(id, value,
+                    PositionT(filename, scanner.line, scanner.column));
+            }
+            else
+            {
+                result = make_token(id, scanner.line);
+            }
 
+            if (guards != nullptr && need_include_guard_detection(language))
+                return guards->detect_guard(result);
             return result;
         }
 
+        ///////////////////////////////////////////////////////////////////////////////
+        //  create a token having the text of the current token as its value,
+        //  the value refers to the retained input if lazy token values are
+        //  enabled (unless it has to be converted or the input is too large)
+        template <typename IteratorT, typename PositionT, typename TokenT>
+        TokenT lexer<IteratorT, PositionT, TokenT>::make_token(
+            token_id id, std::size_t line, bool convert,
+            interned_identifier const& identifier)
+        {
+            constexpr std::size_t max_offset =
+                (std::numeric_limits<std::uint32_t>::max)();
+
+            PositionT pos(filename, line, scanner.column);
+            if (nullptr != scanner.retained && !convert &&
+                static_cast<std::size_t>(scanner.cur - scanner.bot) <=
+                    max_offset)
+            {
+                return token_type(id,
+                    token_value_ref{scanner.retained,
+                        static_cast<std::uint32_t>(scanner.tok - scanner.bot),
+                        static_cast<std::uint32_t>(scanner.cur - scanner.tok)},
+                    pos, identifier);
+            }
+
+            value.assign((char const*) scanner.tok, scanner.cur - scanner.tok);
+            if (convert)
+                value = impl::convert_trigraphs(value);
+            return token_type(id, value, pos, identifier);
+        }
+
         template <typename IteratorT, typename PositionT, typename TokenT>
         int lexer<IteratorT, PositionT, TokenT>::report_error(
             Scanner<IteratorT> const* s, int errcode, char const* msg, ...)
@@ -278,17 +570,16 @@ namespace wave::cpplexer {
             assert(nullptr != s);
             assert(nullptr != msg);
 
-            using namespace std;    // some system have vsprintf in namespace std
-
-            char buffer[200];       // should be large enough
+            char buffer[256];    // longer messages are truncated
             va_list params;
             va_start(params, msg);
-            vsprintf(buffer, msg, params);
+            std::vsnprintf(buffer, sizeof(buffer), msg, params);
             va_end(params);
 
-            WAVE_LEXER_THROW_VAR(lexing_exception, errcode, buffer, s->line,
-                s->column, s->file_name);
-            //    UNREACHABLE_RETURN(0);
+            // throws if no error sink is attached to the scanner
+            report_lexing_error(s->errors,
+                static_cast<lexing_exception::error_code>(errcode), buffer,
+                s->line, s->column, s->file_name);
             return 0;
         }
 
@@ -299,7 +590,7 @@ namespace wave::cpplexer {
         ///////////////////////////////////////////////////////////////////////////////
 
         template <typename IteratorT,
-            typename PositionT = util::file_position_type,
+            typename PositionT = wave::util::file_position_type,
             typename TokenT = typename lexer<IteratorT, PositionT>::token_type>
         class lex_functor : public lex_input_interface_generator<TokenT>
         {
@@ -319,21 +610,44 @@ namespace wave::cpplexer {
             {
                 return re2c_lexer.get(result);
             }
+            token_type& skip_to_matching_conditional(
+                token_type& result) override
+            {
+                return re2c_lexer.skip_to_matching_conditional(result);
+            }
             void set_position(PositionT const& pos) override
             {
                 re2c_lexer.set_position(pos);
             }
+            void set_include_guards(include_guards<TokenT>* guards) override
+            {
+                re2c_lexer.set_include_guards(guards);
+            }
+            void set_value_buffer(token_value_buffer* buffer) override
+            {
+                re2c_lexer.set_value_buffer(buffer);
+            }
+            void set_error_sink(error_sink* errors) override
+            {
+                re2c_lexer.set_error_sink(errors);
+            }
+            void set_line_index(line_index* lines) override
+            {
+                re2c_lexer.set_line_index(lines);
+            }
+            void set_checkpoint_index(checkpoint_index* index) override
+            {
+                re2c_lexer.set_checkpoint_index(index);
+            }
+            void set_identifier_interner(
+                identifier_interner* interner) override
+            {
+                re2c_lexer.set_identifier_interner(interner);
+            }
 
         private:
             lexer<IteratorT, PositionT, TokenT> re2c_lexer;
         };
-
-        ///////////////////////////////////////////////////////////////////////////
-        template <typename IteratorT, typename PositionT, typename TokenT>
-        token_cache<
-            typename lexer<IteratorT, PositionT, TokenT>::string_type> const
-            lexer<IteratorT, PositionT, TokenT>::cache = token_cache<
-                typename lexer<IteratorT, PositionT, TokenT>::string_type>();
     }    // namespace re2clex
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,104 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cassert>
+#include <memory>
+
+#include "../config.hpp"
+#include "../language_support.hpp"
+#include "../reusable_lexer.hpp"
+#include "../token_value_buffer.hpp"
+#include "cpp_re2c_lexer.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename IteratorT, typename PositionT>
+    struct reusable_lexer<IteratorT, PositionT>::data
+    {
+        data(IteratorT const& first, IteratorT const& last,
+            PositionT const& pos, language_support language)
+          : lexer(first, last, pos, language)
+        {
+        }
+
+        // the lexer has to be destroyed before the buffer it may retain its
+        // input in
+        token_value_buffer values;
+        re2clex::lexer<IteratorT, PositionT, token_type> lexer;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename IteratorT, typename PositionT>
+    reusable_lexer<IteratorT, PositionT>::reusable_lexer() noexcept = default;
+
+    template <typename IteratorT, typename PositionT>
+    reusable_lexer<IteratorT, PositionT>::~reusable_lexer() = default;
+
+    template <typename IteratorT, typename PositionT>
+    reusable_lexer<IteratorT, PositionT>::reusable_lexer(
+        reusable_lexer&&) noexcept = default;
+
+    template <typename IteratorT, typename PositionT>
+    reusable_lexer<IteratorT, PositionT>&
+    reusable_lexer<IteratorT, PositionT>::operator=(
+        reusable_lexer&&) noexcept = default;
+
+    template <typename IteratorT, typename PositionT>
+    void reusable_lexer<IteratorT, PositionT>::reset(IteratorT const& first,
+        IteratorT const& last, PositionT const& pos, language_support language)
+    {
+        if (!impl)
+            impl = std::make_unique<data>(first, last, pos, language);
+        else
+            impl->lexer.reset(first, last, pos, language);
+
+        impl->lexer.set_value_buffer(&impl->values);
+        impl->lexer.set_error_sink(errors);
+        impl->lexer.set_include_guards(guards);
+        impl->lexer.set_identifier_interner(interner);
+    }
+
+    template <typename IteratorT, typename PositionT>
+    typename reusable_lexer<IteratorT, PositionT>::token_type&
+    reusable_lexer<IteratorT, PositionT>::get(token_type& result)
+    {
+        assert(impl);    // reset() has to be called first
+        return impl->lexer.get(result);
+    }
+
+    template <typename IteratorT, typename PositionT>
+    void reusable_lexer<IteratorT, PositionT>::set_error_sink(
+        error_sink* errors_) noexcept
+    {
+        errors = errors_;
+        if (impl)
+            impl->lexer.set_error_sink(errors);
+    }
+
+    template <typename IteratorT, typename PositionT>
+    void reusable_lexer<IteratorT, PositionT>::set_include_guards(
+        include_guards<token_type>* guards_) noexcept
+    {
+        guards = guards_;
+        if (impl)
+            impl->lexer.set_include_guards(guards);
+    }
+
+    template <typename IteratorT, typename PositionT>
+    void reusable_lexer<IteratorT, PositionT>::set_identifier_interner(
+        identifier_interner* interner_) noexcept
+    {
+        interner = interner_;
+        if (impl)
+            impl->lexer.set_identifier_interner(interner);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
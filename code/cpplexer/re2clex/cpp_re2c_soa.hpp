@@ -0,0 +1,50 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include "../config.hpp"
+#include "../error_sink.hpp"
+#include "../language_support.hpp"
+#include "../token_ids.hpp"
+#include "../token_soa_buffer.hpp"
+#include "cpp_re.hpp"
+#include "cpp_re2c_visit.hpp"
+#include "scanner.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename IteratorT, typename PositionT>
+    void token_soa_gen<IteratorT, PositionT>::lex(IteratorT const& first,
+        IteratorT const& last, PositionT const& pos, language_support language,
+        token_soa_buffer& result, error_sink* errors)
+    {
+        using namespace re2clex;
+
+        auto const filename = pos.get_file();
+
+        result.clear();
+
+        Scanner<IteratorT> scanner(first, last);
+        start_scanner(scanner, pos, filename.c_str(), language, errors);
+        scanner.retained = &result.input_buffer();
+        scanner.lines = &result.line_table();
+
+        auto store = [&](token_id id, std::string_view value,
+                         std::size_t line, std::size_t column) {
+            result.push_back(
+                id, scanner.tok - scanner.bot, value.size(), line, column);
+        };
+        visit_tokens<uchar_wrapper>(scanner, store);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
@@ -0,0 +1,127 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "../config.hpp"
+#include "../error_sink.hpp"
+#include "../file_position.hpp"
+#include "../language_support.hpp"
+#include "../lex_visitor.hpp"
+#include "../token_ids.hpp"
+#include "cpp_re.hpp"
+#include "cpp_re2c_lexer.hpp"
+#include "scanner.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    namespace re2clex {
+
+        ///////////////////////////////////////////////////////////////////////////////
+        //  prepare a scanner for lexing its input starting at the given
+        //  position, the scanner refers to the given file name
+        template <typename IteratorT, typename PositionT>
+        void start_scanner(Scanner<IteratorT>& scanner, PositionT const& pos,
+            char const* file_name, language_support language,
+            error_sink* errors)
+        {
+            scanner.line = pos.get_line();
+            scanner.column = scanner.curr_column = pos.get_column();
+            scanner.error_proc = lexer<IteratorT, PositionT>::report_error;
+            scanner.file_name = file_name;
+            scanner.errors = errors;
+            configure_scanner(scanner, language);
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        //  Call the visitor for each token of the scanner's input (see
+        //  wave::cpplexer::lex), the columns are tracked only if CursorT is a
+        //  uchar_wrapper. The visitor may access the scanner, the line after
+        //  the current token is scanner.line and the offset of its value in
+        //  the buffer is scanner.tok - scanner.bot.
+        template <typename CursorT, typename IteratorT, typename VisitorT>
+        bool visit_tokens(Scanner<IteratorT>& scanner, VisitorT& visitor)
+        {
+            static_assert(std::is_invocable_v<VisitorT&, token_id,
+                              std::string_view, std::size_t, std::size_t>,
+                "the visitor has to be callable as visitor(token_id, "
+                "std::string_view, std::size_t line, std::size_t column)");
+
+            using result_type = std::invoke_result_t<VisitorT&, token_id,
+                std::string_view, std::size_t, std::size_t>;
+
+            while (true)
+            {
+                std::size_t const line = scanner.line;
+                auto id = static_cast<token_id>(scan<CursorT>(&scanner));
+                if (T_EOF == id)
+                    return true;
+
+                std::string_view const value(
+                    reinterpret_cast<char const*>(scanner.tok),
+                    scanner.cur - scanner.tok);
+
+#if WAVE_SUPPORT_INCLUDE_NEXT != 0
+                // convert to the corresponding ..._next token, if appropriate
+                if (token_action::include == get_token_action(id))
+                {
+                    if (std::size_t const start = value.find("include");
+                        value.compare(start, 12, "include_next") == 0)
+                    {
+                        id = static_cast<token_id>(id | AltTokenType);
+                    }
+                }
+#endif
+                if constexpr (std::is_same_v<result_type, bool>)
+                {
+                    if (!visitor(id, value, line, scanner.column))
+                        return false;
+                }
+                else
+                {
+                    visitor(id, value, line, scanner.column);
+                }
+            }
+        }
+    }    // namespace re2clex
+
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename IteratorT, typename PositionT, typename VisitorT>
+    bool lex(IteratorT const& first, IteratorT const& last,
+        PositionT const& pos, language_support language, VisitorT&& visitor,
+        error_sink* errors)
+    {
+        using namespace re2clex;
+
+        // the columns are tracked only if the position type has one
+        using cursor_type =
+            std::conditional_t<wave::util::has_column<PositionT>::value,
+                uchar_wrapper, uchar*>;
+
+        auto const filename = pos.get_file();
+
+        Scanner<IteratorT> scanner(first, last);
+        start_scanner(scanner, pos, filename.c_str(), language, errors);
+        return visit_tokens<cursor_type>(scanner, visitor);
+    }
+
+    template <typename VisitorT>
+    bool lex(std::string_view buffer, VisitorT&& visitor,
+        language_support language, error_sink* errors)
+    {
+        return lex(buffer.data(), buffer.data() + buffer.size(),
+            wave::util::file_position_type(), language,
+            std::forward<VisitorT>(visitor), errors);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
@@ -11,8 +11,14 @@
 
 #pragma once
 
+#include <cstdlib>
+
+#include "../buffer_pool.hpp"
 #include "../config.hpp"
+#include "../error_sink.hpp"
+#include "../line_index.hpp"
 #include "../re2clex/aq.hpp"
+#include "../token_value_buffer.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace wave::cpplexer::re2clex {
@@ -31,13 +37,39 @@ namespace wave::cpplexer::re2clex {
           : first(f)
           , act(f)
           , last(l)
-          , eol_offsets(aq_create())
         {
         }
 
+        Scanner(Scanner const&) = delete;
+        Scanner& operator=(Scanner const&) = delete;
+
+        // start over with the given input, the buffer and the queue of the
+        // line splice offsets are kept for reuse (the configuration as well)
+        void reset(Iterator const& f, Iterator const& l)
+        {
+            first = act = f;
+            last = l;
+            tok = ptr = cur = lim = bot;
+            eof = nullptr;
+            line = column = curr_column = 0;
+            discarded = 0;
+            spliced = 0;
+            if (nullptr != eol_offsets)
+            {
+                aq_clear(eol_offsets);
+                aq_clear(eol_lengths);
+            }
+        }
+
         ~Scanner()
         {
-            aq_terminate(eol_offsets);
+            if (nullptr != eol_offsets)
+            {
+                aq_terminate(eol_offsets);
+                aq_terminate(eol_lengths);
+            }
+            if (nullptr == retained)
+                cpplexer::detail::release_scanner_buffer(bot, top - bot);
         }
 
         Iterator first;       /* start of input buffer */
@@ -62,7 +94,20 @@ namespace wave::cpplexer::re2clex {
         /* must be != 0, this function is called to report an error */
         ReportErrorProc error_proc = nullptr;
         char const* file_name = nullptr;   /* name of the lex'ed file */
-        aq_queue eol_offsets;
+        /* if not null, errors are reported to this sink instead of thrown */
+        error_sink* errors = nullptr;
+        /* the offsets of the removed line splices, created on demand */
+        aq_queue eol_offsets = nullptr;
+        /* the number of bytes removed by each of these line splices */
+        aq_queue eol_lengths = nullptr;
+        /* if not null, the input is retained in (and owned by) this buffer */
+        token_value_buffer* retained = nullptr;
+        /* if not null, the line starts of the input are recorded here */
+        line_index* lines = nullptr;
+        /* number of bytes discarded from the beginning of the buffer */
+        std::size_t discarded = 0;
+        /* number of bytes removed by the line splices passed so far */
+        std::size_t spliced = 0;
         bool enable_ms_extensions = false; /* enable MS extensions */
         bool act_in_c99_mode = false;      /* lexer works in C99 mode */
         /* lexer should prefer to detect pp-numbers */
@@ -18,7 +18,7 @@
 
 
 
-#line 25 "strict_cpp_re.hpp"
+#line 22 "strict_cpp_re.hpp"
 {
     YYCTYPE yych;
     unsigned int yyaccept = 0;
@@ -224,7 +224,7 @@
     }
 yy2:
     ++YYCURSOR;
-#line 353 "strict_cpp.re"
+#line 347 "strict_cpp.re"
     {
         if (s->eof && cursor != s->eof)
         {
@@ -234,17 +234,21 @@ yy2:
         }
         WAVE_RET(T_EOF);
     }
-#line 241 "strict_cpp_re.hpp"
+#line 238 "strict_cpp_re.hpp"
 yy4:
     ++YYCURSOR;
-#line 366 "strict_cpp.re"
+#line 360 "strict_cpp.re"
     {
         // flag the error
         WAVE_UPDATE_CURSOR();     // adjust the input cursor
         (*s->error_proc)(s, lexing_exception::generic_lexing_error,
             "invalid character '\\%03o' in input stream", *--YYCURSOR);
+
+        // the error was reported to an error sink, skip the character
+        ++YYCURSOR;
+        WAVE_RET(TOKEN_FROM_ID(*s->tok, UnknownTokenType));
     }
-#line 251 "strict_cpp_re.hpp"
+#line 252 "strict_cpp_re.hpp"
 yy6:
     ++YYCURSOR;
     if (YYLIMIT <= YYCURSOR) YYFILL(1);
@@ -252,19 +256,19 @@ yy6:
     if (yybm[256+yych] & 64) {
         goto yy6;
     }
-#line 343 "strict_cpp.re"
+#line 337 "strict_cpp.re"
     { WAVE_RET(T_SPACE); }
-#line 261 "strict_cpp_re.hpp"
+#line 262 "strict_cpp_re.hpp"
 yy9:
     ++YYCURSOR;
 yy10:
-#line 346 "strict_cpp.re"
+#line 340 "strict_cpp.re"
     {
         s->line++;
-        cursor.column = 1;
+        set_column(cursor, 1);
         WAVE_RET(T_NEWLINE);
     }
-#line 271 "strict_cpp_re.hpp"
+#line 272 "strict_cpp_re.hpp"
 yy11:
     yych = *++YYCURSOR;
     if (yych == '\n') goto yy9;
@@ -274,7 +278,7 @@ yy12:
     if (yych == '=') goto yy96;
 #line 209 "strict_cpp.re"
     { WAVE_RET(T_NOT); }
-#line 281 "strict_cpp_re.hpp"
+#line 282 "strict_cpp_re.hpp"
 yy14:
     yyaccept = 0;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -285,9 +289,9 @@ yy14:
         if (yych >= ' ') goto yy99;
     }
 yy15:
-#line 363 "strict_cpp.re"
+#line 357 "strict_cpp.re"
     { WAVE_RET(TOKEN_FROM_ID(*s->tok, UnknownTokenType)); }
-#line 294 "strict_cpp_re.hpp"
+#line 295 "strict_cpp_re.hpp"
 yy16:
     yyaccept = 1;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -328,7 +332,7 @@ yy16:
 yy17:
 #line 158 "strict_cpp.re"
     { WAVE_RET(T_POUND); }
-#line 335 "strict_cpp_re.hpp"
+#line 336 "strict_cpp_re.hpp"
 yy18:
     ++YYCURSOR;
     goto yy15;
@@ -342,14 +346,14 @@ yy19:
     }
 #line 197 "strict_cpp.re"
     { WAVE_RET(T_PERCENT); }
-#line 349 "strict_cpp_re.hpp"
+#line 350 "strict_cpp_re.hpp"
 yy21:
     yych = *++YYCURSOR;
     if (yych == '&') goto yy125;
     if (yych == '=') goto yy127;
 #line 201 "strict_cpp.re"
     { WAVE_RET(T_AND); }
-#line 356 "strict_cpp_re.hpp"
+#line 357 "strict_cpp_re.hpp"
 yy23:
     yyaccept = 0;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -366,30 +370,30 @@ yy24:
     ++YYCURSOR;
 #line 166 "strict_cpp.re"
     { WAVE_RET(T_LEFTPAREN); }
-#line 373 "strict_cpp_re.hpp"
+#line 374 "strict_cpp_re.hpp"
 yy26:
     ++YYCURSOR;
 #line 167 "strict_cpp.re"
     { WAVE_RET(T_RIGHTPAREN); }
-#line 378 "strict_cpp_re.hpp"
+#line 379 "strict_cpp_re.hpp"
 yy28:
     yych = *++YYCURSOR;
     if (yych == '=') goto yy133;
 #line 195 "strict_cpp.re"
     { WAVE_RET(T_STAR); }
-#line 384 "strict_cpp_re.hpp"
+#line 385 "strict_cpp_re.hpp"
 yy30:
     yych = *++YYCURSOR;
     if (yych == '+') goto yy135;
     if (yych == '=') goto yy137;
 #line 193 "strict_cpp.re"
     { WAVE_RET(T_PLUS); }
-#line 391 "strict_cpp_re.hpp"
+#line 392 "strict_cpp_re.hpp"
 yy32:
     ++YYCURSOR;
 #line 255 "strict_cpp.re"
     { WAVE_RET(T_COMMA); }
-#line 396 "strict_cpp_re.hpp"
+#line 397 "strict_cpp_re.hpp"
 yy34:
     yych = *++YYCURSOR;
     if (yych <= '<') {
@@ -400,7 +404,7 @@ yy34:
     }
 #line 194 "strict_cpp.re"
     { WAVE_RET(T_MINUS); }
-#line 407 "strict_cpp_re.hpp"
+#line 408 "strict_cpp_re.hpp"
 yy36:
     yyaccept = 2;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -414,7 +418,7 @@ yy36:
 yy37:
 #line 182 "strict_cpp.re"
     { WAVE_RET(T_DOT); }
-#line 421 "strict_cpp_re.hpp"
+#line 422 "strict_cpp_re.hpp"
 yy38:
     yych = *++YYCURSOR;
     if (yych <= '.') {
@@ -425,24 +429,24 @@ yy38:
     }
 #line 196 "strict_cpp.re"
     { WAVE_RET(T_DIVIDE); }
-#line 432 "strict_cpp_re.hpp"
+#line 433 "strict_cpp_re.hpp"
 yy40:
     ++YYCURSOR;
 #line 45 "strict_cpp.re"
     { goto pp_number; }
-#line 437 "strict_cpp_re.hpp"
+#line 438 "strict_cpp_re.hpp"
 yy42:
     yych = *++YYCURSOR;
     if (yych == ':') goto yy154;
     if (yych == '>') goto yy156;
 #line 169 "strict_cpp.re"
     { WAVE_RET(T_COLON); }
-#line 444 "strict_cpp_re.hpp"
+#line 445 "strict_cpp_re.hpp"
 yy44:
     ++YYCURSOR;
 #line 168 "strict_cpp.re"
     { WAVE_RET(T_SEMICOLON); }
-#line 449 "strict_cpp_re.hpp"
+#line 450 "strict_cpp_re.hpp"
 yy46:
     yych = *++YYCURSOR;
     if (yych <= ':') {
@@ -456,13 +460,13 @@ yy46:
 yy47:
 #line 212 "strict_cpp.re"
     { WAVE_RET(T_LESS); }
-#line 463 "strict_cpp_re.hpp"
+#line 464 "strict_cpp_re.hpp"
 yy48:
     yych = *++YYCURSOR;
     if (yych == '=') goto yy166;
 #line 211 "strict_cpp.re"
     { WAVE_RET(T_ASSIGN); }
-#line 469 "strict_cpp_re.hpp"
+#line 470 "strict_cpp_re.hpp"
 yy50:
     yych = *++YYCURSOR;
     if (yych <= '<') goto yy51;
@@ -471,7 +475,7 @@ yy50:
 yy51:
 #line 213 "strict_cpp.re"
     { WAVE_RET(T_GREATER); }
-#line 478 "strict_cpp_re.hpp"
+#line 479 "strict_cpp_re.hpp"
 yy52:
     yyaccept = 3;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -479,7 +483,7 @@ yy52:
 yy53:
 #line 171 "strict_cpp.re"
     { WAVE_RET(T_QUESTION_MARK); }
-#line 486 "strict_cpp_re.hpp"
+#line 487 "strict_cpp_re.hpp"
 yy54:
     yyaccept = 4;
     YYMARKER = ++YYCURSOR;
@@ -492,9 +496,9 @@ yy55:
     if (yych == '?') goto yy173;
     if (yych == '\\') goto yy174;
 yy56:
-#line 314 "strict_cpp.re"
+#line 308 "strict_cpp.re"
     { WAVE_RET(T_IDENTIFIER); }
-#line 501 "strict_cpp_re.hpp"
+#line 502 "strict_cpp_re.hpp"
 yy57:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -525,7 +529,7 @@ yy60:
     ++YYCURSOR;
 #line 152 "strict_cpp.re"
     { WAVE_RET(T_LEFTBRACKET); }
-#line 532 "strict_cpp_re.hpp"
+#line 533 "strict_cpp_re.hpp"
 yy62:
     yyaccept = 0;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -536,13 +540,13 @@ yy63:
     ++YYCURSOR;
 #line 155 "strict_cpp.re"
     { WAVE_RET(T_RIGHTBRACKET); }
-#line 543 "strict_cpp_re.hpp"
+#line 544 "strict_cpp_re.hpp"
 yy65:
     yych = *++YYCURSOR;
     if (yych == '=') goto yy185;
 #line 198 "strict_cpp.re"
     { WAVE_RET(T_XOR); }
-#line 549 "strict_cpp_re.hpp"
+#line 550 "strict_cpp_re.hpp"
 yy67:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -739,7 +743,7 @@ yy88:
     ++YYCURSOR;
 #line 146 "strict_cpp.re"
     { WAVE_RET(T_LEFTBRACE); }
-#line 746 "strict_cpp_re.hpp"
+#line 747 "strict_cpp_re.hpp"
 yy90:
     yyaccept = 5;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -752,22 +756,22 @@ yy90:
 yy91:
 #line 203 "strict_cpp.re"
     { WAVE_RET(T_OR); }
-#line 759 "strict_cpp_re.hpp"
+#line 760 "strict_cpp_re.hpp"
 yy92:
     ++YYCURSOR;
 #line 149 "strict_cpp.re"
     { WAVE_RET(T_RIGHTBRACE); }
-#line 764 "strict_cpp_re.hpp"
+#line 765 "strict_cpp_re.hpp"
 yy94:
     ++YYCURSOR;
 #line 206 "strict_cpp.re"
     { WAVE_RET(T_COMPL); }
-#line 769 "strict_cpp_re.hpp"
+#line 770 "strict_cpp_re.hpp"
 yy96:
     ++YYCURSOR;
 #line 232 "strict_cpp.re"
     { WAVE_RET(T_NOTEQUAL); }
-#line 774 "strict_cpp_re.hpp"
+#line 775 "strict_cpp_re.hpp"
 yy98:
     ++YYCURSOR;
     if (YYLIMIT <= YYCURSOR) YYFILL(1);
@@ -1272,7 +1276,7 @@ yy101:
 yy102:
 #line 273 "strict_cpp.re"
     { WAVE_RET(T_STRINGLIT); }
-#line 1279 "strict_cpp_re.hpp"
+#line 1280 "strict_cpp_re.hpp"
 yy103:
     ++YYCURSOR;
     if (YYLIMIT <= YYCURSOR) YYFILL(1);
@@ -1380,7 +1384,7 @@ yy107:
     ++YYCURSOR;
 #line 161 "strict_cpp.re"
     { WAVE_RET(T_POUND_POUND); }
-#line 1387 "strict_cpp_re.hpp"
+#line 1388 "strict_cpp_re.hpp"
 yy109:
     ++YYCURSOR;
     if (YYLIMIT <= YYCURSOR) YYFILL(1);
@@ -1469,27 +1473,27 @@ yy119:
 yy120:
 #line 159 "strict_cpp.re"
     { WAVE_RET(T_POUND_ALT); }
-#line 1476 "strict_cpp_re.hpp"
+#line 1477 "strict_cpp_re.hpp"
 yy121:
     ++YYCURSOR;
 #line 218 "strict_cpp.re"
     { WAVE_RET(T_PERCENTASSIGN); }
-#line 1481 "strict_cpp_re.hpp"
+#line 1482 "strict_cpp_re.hpp"
 yy123:
     ++YYCURSOR;
 #line 151 "strict_cpp.re"
     { WAVE_RET(T_RIGHTBRACE_ALT); }
-#line 1486 "strict_cpp_re.hpp"
+#line 1487 "strict_cpp_re.hpp"
 yy125:
     ++YYCURSOR;
 #line 246 "strict_cpp.re"
     { WAVE_RET(T_ANDAND); }
-#line 1491 "strict_cpp_re.hpp"
+#line 1492 "strict_cpp_re.hpp"
 yy127:
     ++YYCURSOR;
 #line 222 "strict_cpp.re"
     { WAVE_RET(T_ANDASSIGN); }
-#line 1496 "strict_cpp_re.hpp"
+#line 1497 "strict_cpp_re.hpp"
 yy129:
     ++YYCURSOR;
     if (YYLIMIT <= YYCURSOR) YYFILL(1);
@@ -1562,33 +1566,33 @@ yy133:
     ++YYCURSOR;
 #line 216 "strict_cpp.re"
     { WAVE_RET(T_STARASSIGN); }
-#line 1569 "strict_cpp_re.hpp"
+#line 1570 "strict_cpp_re.hpp"
 yy135:
     ++YYCURSOR;
 #line 253 "strict_cpp.re"
     { WAVE_RET(T_PLUSPLUS); }
-#line 1574 "strict_cpp_re.hpp"
+#line 1575 "strict_cpp_re.hpp"
 yy137:
     ++YYCURSOR;
 #line 214 "strict_cpp.re"
     { WAVE_RET(T_PLUSASSIGN); }
-#line 1579 "strict_cpp_re.hpp"
+#line 1580 "strict_cpp_re.hpp"
 yy139:
     ++YYCURSOR;
 #line 254 "strict_cpp.re"
     { WAVE_RET(T_MINUSMINUS); }
-#line 1584 "strict_cpp_re.hpp"
+#line 1585 "strict_cpp_re.hpp"
 yy141:
     ++YYCURSOR;
 #line 215 "strict_cpp.re"
     { WAVE_RET(T_MINUSASSIGN); }
-#line 1589 "strict_cpp_re.hpp"
+#line 1590 "strict_cpp_re.hpp"
 yy143:
     yych = *++YYCURSOR;
     if (yych == '*') goto yy283;
 #line 266 "strict_cpp.re"
     { WAVE_RET(T_ARROW); }
-#line 1595 "strict_cpp_re.hpp"
+#line 1596 "strict_cpp_re.hpp"
 yy145:
     ++YYCURSOR;
 #line 184 "strict_cpp.re"
@@ -1601,7 +1605,7 @@ yy145:
                 WAVE_RET(T_DOTSTAR);
             }
         }
-#line 1608 "strict_cpp_re.hpp"
+#line 1609 "strict_cpp_re.hpp"
 yy147:
     yych = *++YYCURSOR;
     if (yych == '.') goto yy285;
@@ -1610,17 +1614,17 @@ yy148:
     ++YYCURSOR;
 #line 43 "strict_cpp.re"
     { goto ccomment; }
-#line 1617 "strict_cpp_re.hpp"
+#line 1618 "strict_cpp_re.hpp"
 yy150:
     ++YYCURSOR;
 #line 44 "strict_cpp.re"
     { goto cppcomment; }
-#line 1622 "strict_cpp_re.hpp"
+#line 1623 "strict_cpp_re.hpp"
 yy152:
     ++YYCURSOR;
 #line 217 "strict_cpp.re"
     { WAVE_RET(T_DIVIDEASSIGN); }
-#line 1627 "strict_cpp_re.hpp"
+#line 1628 "strict_cpp_re.hpp"
 yy154:
     ++YYCURSOR;
 #line 173 "strict_cpp.re"
@@ -1633,50 +1637,50 @@ yy154:
                 WAVE_RET(T_COLON_COLON);
             }
         }
-#line 1640 "strict_cpp_re.hpp"
+#line 1641 "strict_cpp_re.hpp"
 yy156:
     ++YYCURSOR;
 #line 157 "strict_cpp.re"
     { WAVE_RET(T_RIGHTBRACKET_ALT); }
-#line 1645 "strict_cpp_re.hpp"
+#line 1646 "strict_cpp_re.hpp"
 yy158:
     ++YYCURSOR;
 #line 148 "strict_cpp.re"
     { WAVE_RET(T_LEFTBRACE_ALT); }
-#line 1650 "strict_cpp_re.hpp"
+#line 1651 "strict_cpp_re.hpp"
 yy160:
     ++YYCURSOR;
 #line 154 "strict_cpp.re"
     { WAVE_RET(T_LEFTBRACKET_ALT); }
-#line 1655 "strict_cpp_re.hpp"
+#line 1656 "strict_cpp_re.hpp"
 yy162:
     yych = *++YYCURSOR;
     if (yych == '=') goto yy287;
 #line 227 "strict_cpp.re"
     { WAVE_RET(T_SHIFTLEFT); }
-#line 1661 "strict_cpp_re.hpp"
+#line 1662 "strict_cpp_re.hpp"
 yy164:
     yych = *++YYCURSOR;
     if (yych == '>') goto yy289;
 #line 244 "strict_cpp.re"
     { WAVE_RET(T_LESSEQUAL); }
-#line 1667 "strict_cpp_re.hpp"
+#line 1668 "strict_cpp_re.hpp"
 yy166:
     ++YYCURSOR;
 #line 231 "strict_cpp.re"
     { WAVE_RET(T_EQUAL); }
-#line 1672 "strict_cpp_re.hpp"
+#line 1673 "strict_cpp_re.hpp"
 yy168:
     ++YYCURSOR;
 #line 245 "strict_cpp.re"
     { WAVE_RET(T_GREATEREQUAL); }
-#line 1677 "strict_cpp_re.hpp"
+#line 1678 "strict_cpp_re.hpp"
 yy170:
     yych = *++YYCURSOR;
     if (yych == '=') goto yy291;
 #line 228 "strict_cpp.re"
     { WAVE_RET(T_SHIFTRIGHT); }
-#line 1683 "strict_cpp_re.hpp"
+#line 1684 "strict_cpp_re.hpp"
 yy172:
     yych = *++YYCURSOR;
     switch (yych) {
@@ -1713,34 +1717,31 @@ yy176:
 #line 276 "strict_cpp.re"
     {
             if (s->act_in_cpp0x_mode)
-            {
-                rawstringdelim = "";
                 goto extrawstringlit;
-            }
             --YYCURSOR;
             WAVE_RET(T_IDENTIFIER);
         }
-#line 1727 "strict_cpp_re.hpp"
+#line 1725 "strict_cpp_re.hpp"
 yy178:
     ++YYCURSOR;
-#line 295 "strict_cpp.re"
+#line 292 "strict_cpp.re"
     {
             if (s->act_in_cpp0x_mode)
                 goto extstringlit;
             --YYCURSOR;
             WAVE_RET(T_IDENTIFIER);
         }
-#line 1737 "strict_cpp_re.hpp"
+#line 1735 "strict_cpp_re.hpp"
 yy180:
     ++YYCURSOR;
-#line 287 "strict_cpp.re"
+#line 284 "strict_cpp.re"
     {
             if (s->act_in_cpp0x_mode)
                 goto extcharlit;
             --YYCURSOR;
             WAVE_RET(T_IDENTIFIER);
         }
-#line 1747 "strict_cpp_re.hpp"
+#line 1745 "strict_cpp_re.hpp"
 yy182:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -1778,7 +1779,7 @@ yy185:
     ++YYCURSOR;
 #line 219 "strict_cpp.re"
     { WAVE_RET(T_XORASSIGN); }
-#line 1785 "strict_cpp_re.hpp"
+#line 1783 "strict_cpp_re.hpp"
 yy187:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -1928,7 +1929,7 @@ yy207:
 yy208:
 #line 73 "strict_cpp.re"
     { WAVE_RET(T_DO); }
-#line 1935 "strict_cpp_re.hpp"
+#line 1933 "strict_cpp_re.hpp"
 yy209:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -1986,7 +1987,7 @@ yy218:
 yy219:
 #line 86 "strict_cpp.re"
     { WAVE_RET(T_IF); }
-#line 1993 "strict_cpp_re.hpp"
+#line 1991 "strict_cpp_re.hpp"
 yy220:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -2057,7 +2058,7 @@ yy229:
 yy230:
 #line 251 "strict_cpp.re"
     { WAVE_RET(s->act_in_c99_mode ? T_IDENTIFIER : T_OROR_ALT); }
-#line 2064 "strict_cpp_re.hpp"
+#line 2062 "strict_cpp_re.hpp"
 yy231:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -2170,7 +2171,7 @@ yy250:
     ++YYCURSOR;
 #line 224 "strict_cpp.re"
     { WAVE_RET(T_ORASSIGN); }
-#line 2177 "strict_cpp_re.hpp"
+#line 2175 "strict_cpp_re.hpp"
 yy252:
     yych = *++YYCURSOR;
     if (yych == '?') goto yy404;
@@ -2179,7 +2180,7 @@ yy253:
     ++YYCURSOR;
 #line 248 "strict_cpp.re"
     { WAVE_RET(T_OROR); }
-#line 2186 "strict_cpp_re.hpp"
+#line 2184 "strict_cpp_re.hpp"
 yy255:
     ++YYCURSOR;
     if (YYLIMIT <= YYCURSOR) YYFILL(1);
@@ -2284,9 +2285,9 @@ yy267:
     if (yych == 'd') goto yy418;
     if (yych == 'n') goto yy419;
 yy268:
-#line 325 "strict_cpp.re"
+#line 319 "strict_cpp.re"
     { WAVE_RET(T_PP_IF); }
-#line 2293 "strict_cpp_re.hpp"
+#line 2291 "strict_cpp_re.hpp"
 yy269:
     yych = *++YYCURSOR;
     if (yych == 'c') goto yy420;
@@ -2320,7 +2321,7 @@ yy276:
 yy277:
 #line 270 "strict_cpp.re"
     { WAVE_RET(T_CHARLIT); }
-#line 2327 "strict_cpp_re.hpp"
+#line 2325 "strict_cpp_re.hpp"
 yy278:
     ++YYCURSOR;
     if (YYLIMIT <= YYCURSOR) YYFILL(1);
@@ -2399,17 +2400,17 @@ yy283:
                 WAVE_RET(T_ARROWSTAR);
             }
         }
-#line 2406 "strict_cpp_re.hpp"
+#line 2404 "strict_cpp_re.hpp"
 yy285:
     ++YYCURSOR;
 #line 170 "strict_cpp.re"
     { WAVE_RET(T_ELLIPSIS); }
-#line 2411 "strict_cpp_re.hpp"
+#line 2409 "strict_cpp_re.hpp"
 yy287:
     ++YYCURSOR;
 #line 230 "strict_cpp.re"
     { WAVE_RET(T_SHIFTLEFTASSIGN); }
-#line 2416 "strict_cpp_re.hpp"
+#line 2414 "strict_cpp_re.hpp"
 yy289:
     ++YYCURSOR;
 #line 235 "strict_cpp.re"
@@ -2422,12 +2423,12 @@ yy289:
                 WAVE_RET(T_LESSEQUAL);
             }
         }
-#line 2429 "strict_cpp_re.hpp"
+#line 2427 "strict_cpp_re.hpp"
 yy291:
     ++YYCURSOR;
 #line 229 "strict_cpp.re"
     { WAVE_RET(T_SHIFTRIGHTASSIGN); }
-#line 2434 "strict_cpp_re.hpp"
+#line 2432 "strict_cpp_re.hpp"
 yy293:
     yyaccept = 11;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -2440,28 +2441,28 @@ yy293:
 yy294:
 #line 205 "strict_cpp.re"
     { WAVE_RET(T_OR_TRIGRAPH); }
-#line 2447 "strict_cpp_re.hpp"
+#line 2445 "strict_cpp_re.hpp"
 yy295:
     yych = *++YYCURSOR;
     if (yych == '=') goto yy437;
 #line 199 "strict_cpp.re"
     { WAVE_RET(T_XOR_TRIGRAPH); }
-#line 2453 "strict_cpp_re.hpp"
+#line 2451 "strict_cpp_re.hpp"
 yy297:
     ++YYCURSOR;
 #line 153 "strict_cpp.re"
     { WAVE_RET(T_LEFTBRACKET_TRIGRAPH); }
-#line 2458 "strict_cpp_re.hpp"
+#line 2456 "strict_cpp_re.hpp"
 yy299:
     ++YYCURSOR;
 #line 156 "strict_cpp.re"
     { WAVE_RET(T_RIGHTBRACKET_TRIGRAPH); }
-#line 2463 "strict_cpp_re.hpp"
+#line 2461 "strict_cpp_re.hpp"
 yy301:
     ++YYCURSOR;
 #line 207 "strict_cpp.re"
     { WAVE_RET(T_COMPL_TRIGRAPH); }
-#line 2468 "strict_cpp_re.hpp"
+#line 2466 "strict_cpp_re.hpp"
 yy303:
     yyaccept = 12;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -2470,12 +2471,12 @@ yy303:
 yy304:
 #line 267 "strict_cpp.re"
     { WAVE_RET(T_ANY_TRIGRAPH); }
-#line 2477 "strict_cpp_re.hpp"
+#line 2475 "strict_cpp_re.hpp"
 yy305:
     ++YYCURSOR;
 #line 147 "strict_cpp.re"
     { WAVE_RET(T_LEFTBRACE_TRIGRAPH); }
-#line 2482 "strict_cpp_re.hpp"
+#line 2480 "strict_cpp_re.hpp"
 yy307:
     yyaccept = 13;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -2516,12 +2517,12 @@ yy307:
 yy308:
 #line 160 "strict_cpp.re"
     { WAVE_RET(T_POUND_TRIGRAPH); }
-#line 2523 "strict_cpp_re.hpp"
+#line 2521 "strict_cpp_re.hpp"
 yy309:
     ++YYCURSOR;
 #line 150 "strict_cpp.re"
     { WAVE_RET(T_RIGHTBRACE_TRIGRAPH); }
-#line 2528 "strict_cpp_re.hpp"
+#line 2526 "strict_cpp_re.hpp"
 yy311:
     ++YYCURSOR;
     if (YYLIMIT <= YYCURSOR) YYFILL(1);
@@ -2530,17 +2531,14 @@ yy311:
     goto yy100;
 yy312:
     ++YYCURSOR;
-#line 303 "strict_cpp.re"
+#line 300 "strict_cpp.re"
     {
             if (s->act_in_cpp0x_mode)
-            {
-                rawstringdelim = "";
                 goto extrawstringlit;
-            }
             --YYCURSOR;
             WAVE_RET(T_IDENTIFIER);
         }
-#line 2547 "strict_cpp_re.hpp"
+#line 2542 "strict_cpp_re.hpp"
 yy314:
     ++YYCURSOR;
     if (YYLIMIT <= YYCURSOR) YYFILL(1);
@@ -2658,7 +2656,7 @@ yy329:
 yy330:
 #line 247 "strict_cpp.re"
     { WAVE_RET(s->act_in_c99_mode ? T_IDENTIFIER : T_ANDAND_ALT); }
-#line 2665 "strict_cpp_re.hpp"
+#line 2660 "strict_cpp_re.hpp"
 yy331:
     yyaccept = 15;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -2670,7 +2668,7 @@ yy331:
 yy332:
 #line 49 "strict_cpp.re"
     { WAVE_RET(T_ASM); }
-#line 2677 "strict_cpp_re.hpp"
+#line 2672 "strict_cpp_re.hpp"
 yy333:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -2806,7 +2804,7 @@ yy355:
 yy356:
 #line 83 "strict_cpp.re"
     { WAVE_RET(T_FOR); }
-#line 2813 "strict_cpp_re.hpp"
+#line 2808 "strict_cpp_re.hpp"
 yy357:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -2838,7 +2836,7 @@ yy361:
 yy362:
 #line 89 "strict_cpp.re"
     { WAVE_RET(T_INT); }
-#line 2845 "strict_cpp_re.hpp"
+#line 2840 "strict_cpp_re.hpp"
 yy363:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -2865,7 +2863,7 @@ yy366:
 yy367:
 #line 93 "strict_cpp.re"
     { WAVE_RET(T_NEW); }
-#line 2872 "strict_cpp_re.hpp"
+#line 2867 "strict_cpp_re.hpp"
 yy368:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -2894,7 +2892,7 @@ yy369:
 yy370:
 #line 210 "strict_cpp.re"
     { WAVE_RET(s->act_in_c99_mode ? T_IDENTIFIER : T_NOT_ALT); }
-#line 2901 "strict_cpp_re.hpp"
+#line 2896 "strict_cpp_re.hpp"
 yy371:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -3007,7 +3005,7 @@ yy391:
 yy392:
 #line 117 "strict_cpp.re"
     { WAVE_RET(T_TRY); }
-#line 3014 "strict_cpp_re.hpp"
+#line 3009 "strict_cpp_re.hpp"
 yy393:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -3076,7 +3074,7 @@ yy402:
 yy403:
 #line 200 "strict_cpp.re"
     { WAVE_RET(s->act_in_c99_mode ? T_IDENTIFIER : T_XOR_ALT); }
-#line 3083 "strict_cpp_re.hpp"
+#line 3078 "strict_cpp_re.hpp"
 yy404:
     yych = *++YYCURSOR;
     if (yych == '!') goto yy538;
@@ -3139,7 +3137,7 @@ yy411:
     ++YYCURSOR;
 #line 162 "strict_cpp.re"
     { WAVE_RET(T_POUND_POUND_TRIGRAPH); }
-#line 3146 "strict_cpp_re.hpp"
+#line 3141 "strict_cpp_re.hpp"
 yy413:
     yych = *++YYCURSOR;
     if (yych == 'i') goto yy543;
@@ -3197,7 +3195,7 @@ yy426:
     ++YYCURSOR;
 #line 165 "strict_cpp.re"
     { WAVE_RET(T_POUND_POUND_ALT); }
-#line 3204 "strict_cpp_re.hpp"
+#line 3199 "strict_cpp_re.hpp"
 yy428:
     ++YYCURSOR;
     if (YYLIMIT <= YYCURSOR) YYFILL(1);
@@ -3241,7 +3239,7 @@ yy432:
     ++YYCURSOR;
 #line 226 "strict_cpp.re"
     { WAVE_RET(T_ORASSIGN_TRIGRAPH); }
-#line 3248 "strict_cpp_re.hpp"
+#line 3243 "strict_cpp_re.hpp"
 yy434:
     yych = *++YYCURSOR;
     if (yych == '?') goto yy563;
@@ -3250,17 +3248,17 @@ yy435:
     ++YYCURSOR;
 #line 249 "strict_cpp.re"
     { WAVE_RET(T_OROR_TRIGRAPH); }
-#line 3257 "strict_cpp_re.hpp"
+#line 3252 "strict_cpp_re.hpp"
 yy437:
     ++YYCURSOR;
 #line 221 "strict_cpp.re"
     { WAVE_RET(T_XORASSIGN_TRIGRAPH); }
-#line 3262 "strict_cpp_re.hpp"
+#line 3257 "strict_cpp_re.hpp"
 yy439:
     ++YYCURSOR;
 #line 163 "strict_cpp.re"
     { WAVE_RET(T_POUND_POUND_TRIGRAPH); }
-#line 3267 "strict_cpp_re.hpp"
+#line 3262 "strict_cpp_re.hpp"
 yy441:
     yych = *++YYCURSOR;
     if (yych == '?') goto yy564;
@@ -3330,7 +3328,7 @@ yy449:
 yy450:
 #line 144 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_ASM : T_IDENTIFIER); }
-#line 3337 "strict_cpp_re.hpp"
+#line 3332 "strict_cpp_re.hpp"
 yy451:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -3382,7 +3380,7 @@ yy459:
 yy460:
 #line 50 "strict_cpp.re"
     { WAVE_RET(T_AUTO); }
-#line 3389 "strict_cpp_re.hpp"
+#line 3384 "strict_cpp_re.hpp"
 yy461:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -3404,7 +3402,7 @@ yy463:
 yy464:
 #line 51 "strict_cpp.re"
     { WAVE_RET(T_BOOL); }
-#line 3411 "strict_cpp_re.hpp"
+#line 3406 "strict_cpp_re.hpp"
 yy465:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -3421,7 +3419,7 @@ yy466:
 yy467:
 #line 53 "strict_cpp.re"
     { WAVE_RET(T_CASE); }
-#line 3428 "strict_cpp_re.hpp"
+#line 3423 "strict_cpp_re.hpp"
 yy468:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -3464,7 +3462,7 @@ yy469:
 yy470:
 #line 55 "strict_cpp.re"
     { WAVE_RET(T_CHAR); }
-#line 3471 "strict_cpp_re.hpp"
+#line 3466 "strict_cpp_re.hpp"
 yy471:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -3541,7 +3539,7 @@ yy484:
 yy485:
 #line 76 "strict_cpp.re"
     { WAVE_RET(T_ELSE); }
-#line 3548 "strict_cpp_re.hpp"
+#line 3543 "strict_cpp_re.hpp"
 yy486:
     yyaccept = 28;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -3553,7 +3551,7 @@ yy486:
 yy487:
 #line 77 "strict_cpp.re"
     { WAVE_RET(T_ENUM); }
-#line 3560 "strict_cpp_re.hpp"
+#line 3555 "strict_cpp_re.hpp"
 yy488:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -3595,7 +3593,7 @@ yy494:
 yy495:
 #line 85 "strict_cpp.re"
     { WAVE_RET(T_GOTO); }
-#line 3602 "strict_cpp_re.hpp"
+#line 3597 "strict_cpp_re.hpp"
 yy496:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -3617,7 +3615,7 @@ yy498:
 yy499:
 #line 90 "strict_cpp.re"
     { WAVE_RET(T_LONG); }
-#line 3624 "strict_cpp_re.hpp"
+#line 3619 "strict_cpp_re.hpp"
 yy500:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -3734,7 +3732,7 @@ yy521:
 yy522:
 #line 113 "strict_cpp.re"
     { WAVE_RET(T_THIS); }
-#line 3741 "strict_cpp_re.hpp"
+#line 3736 "strict_cpp_re.hpp"
 yy523:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -3756,7 +3754,7 @@ yy525:
 yy526:
 #line 116 "strict_cpp.re"
     { WAVE_RET(T_TRUE); }
-#line 3763 "strict_cpp_re.hpp"
+#line 3758 "strict_cpp_re.hpp"
 yy527:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -3799,7 +3797,7 @@ yy532:
 yy533:
 #line 125 "strict_cpp.re"
     { WAVE_RET(T_VOID); }
-#line 3806 "strict_cpp_re.hpp"
+#line 3801 "strict_cpp_re.hpp"
 yy534:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -3824,7 +3822,7 @@ yy538:
     ++YYCURSOR;
 #line 250 "strict_cpp.re"
     { WAVE_RET(T_OROR_TRIGRAPH); }
-#line 3831 "strict_cpp_re.hpp"
+#line 3826 "strict_cpp_re.hpp"
 yy540:
     yyaccept = 34;
     YYMARKER = ++YYCURSOR;
@@ -3871,14 +3869,14 @@ yy543:
     goto yy100;
 yy544:
     ++YYCURSOR;
-#line 329 "strict_cpp.re"
+#line 323 "strict_cpp.re"
     { WAVE_RET(T_PP_ELIF); }
-#line 3880 "strict_cpp_re.hpp"
+#line 3875 "strict_cpp_re.hpp"
 yy546:
     ++YYCURSOR;
-#line 328 "strict_cpp.re"
+#line 322 "strict_cpp.re"
     { WAVE_RET(T_PP_ELSE); }
-#line 3885 "strict_cpp_re.hpp"
+#line 3880 "strict_cpp_re.hpp"
 yy548:
     yych = *++YYCURSOR;
     if (yych == 'f') goto yy659;
@@ -3905,9 +3903,9 @@ yy553:
     goto yy100;
 yy554:
     ++YYCURSOR;
-#line 333 "strict_cpp.re"
+#line 327 "strict_cpp.re"
     { WAVE_RET(T_PP_LINE); }
-#line 3914 "strict_cpp_re.hpp"
+#line 3909 "strict_cpp_re.hpp"
 yy556:
     yych = *++YYCURSOR;
     if (yych == 'm') goto yy668;
@@ -4036,7 +4034,7 @@ yy571:
 yy572:
 #line 139 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_TRY : T_IDENTIFIER); }
-#line 4043 "strict_cpp_re.hpp"
+#line 4038 "strict_cpp_re.hpp"
 yy573:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4094,7 +4092,7 @@ yy582:
 yy583:
 #line 204 "strict_cpp.re"
     { WAVE_RET(s->act_in_c99_mode ? T_IDENTIFIER : T_OR_ALT); }
-#line 4101 "strict_cpp_re.hpp"
+#line 4096 "strict_cpp_re.hpp"
 yy584:
     yyaccept = 38;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4106,7 +4104,7 @@ yy584:
 yy585:
 #line 52 "strict_cpp.re"
     { WAVE_RET(T_BREAK); }
-#line 4113 "strict_cpp_re.hpp"
+#line 4108 "strict_cpp_re.hpp"
 yy586:
     yyaccept = 39;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4118,7 +4116,7 @@ yy586:
 yy587:
 #line 54 "strict_cpp.re"
     { WAVE_RET(T_CATCH); }
-#line 4125 "strict_cpp_re.hpp"
+#line 4120 "strict_cpp_re.hpp"
 yy588:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4145,7 +4143,7 @@ yy591:
 yy592:
 #line 59 "strict_cpp.re"
     { WAVE_RET(T_CLASS); }
-#line 4152 "strict_cpp_re.hpp"
+#line 4147 "strict_cpp_re.hpp"
 yy593:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4172,7 +4170,7 @@ yy596:
 yy597:
 #line 208 "strict_cpp.re"
     { WAVE_RET(s->act_in_c99_mode ? T_IDENTIFIER : T_COMPL_ALT); }
-#line 4179 "strict_cpp_re.hpp"
+#line 4174 "strict_cpp_re.hpp"
 yy598:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4208,7 +4206,7 @@ yy599:
 yy600:
 #line 61 "strict_cpp.re"
     { WAVE_RET(T_CONST); }
-#line 4215 "strict_cpp_re.hpp"
+#line 4210 "strict_cpp_re.hpp"
 yy601:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4265,7 +4263,7 @@ yy610:
 yy611:
 #line 81 "strict_cpp.re"
     { WAVE_RET(T_FALSE); }
-#line 4272 "strict_cpp_re.hpp"
+#line 4267 "strict_cpp_re.hpp"
 yy612:
     yyaccept = 44;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4277,7 +4275,7 @@ yy612:
 yy613:
 #line 82 "strict_cpp.re"
     { WAVE_RET(T_FLOAT); }
-#line 4284 "strict_cpp_re.hpp"
+#line 4279 "strict_cpp_re.hpp"
 yy614:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4334,7 +4332,7 @@ yy623:
 yy624:
 #line 225 "strict_cpp.re"
     { WAVE_RET(s->act_in_c99_mode ? T_IDENTIFIER : T_ORASSIGN_ALT); }
-#line 4341 "strict_cpp_re.hpp"
+#line 4336 "strict_cpp_re.hpp"
 yy625:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4381,7 +4379,7 @@ yy632:
 yy633:
 #line 104 "strict_cpp.re"
     { WAVE_RET(T_SHORT); }
-#line 4388 "strict_cpp_re.hpp"
+#line 4383 "strict_cpp_re.hpp"
 yy634:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4428,7 +4426,7 @@ yy641:
 yy642:
 #line 115 "strict_cpp.re"
     { WAVE_RET(T_THROW); }
-#line 4435 "strict_cpp_re.hpp"
+#line 4430 "strict_cpp_re.hpp"
 yy643:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4455,7 +4453,7 @@ yy646:
 yy647:
 #line 121 "strict_cpp.re"
     { WAVE_RET(T_UNION); }
-#line 4462 "strict_cpp_re.hpp"
+#line 4457 "strict_cpp_re.hpp"
 yy648:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4472,7 +4470,7 @@ yy649:
 yy650:
 #line 123 "strict_cpp.re"
     { WAVE_RET(T_USING); }
-#line 4479 "strict_cpp_re.hpp"
+#line 4474 "strict_cpp_re.hpp"
 yy651:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4499,7 +4497,7 @@ yy654:
 yy655:
 #line 128 "strict_cpp.re"
     { WAVE_RET(T_WHILE); }
-#line 4506 "strict_cpp_re.hpp"
+#line 4501 "strict_cpp_re.hpp"
 yy656:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4525,23 +4523,23 @@ yy658:
     goto yy100;
 yy659:
     ++YYCURSOR;
-#line 330 "strict_cpp.re"
+#line 324 "strict_cpp.re"
     { WAVE_RET(T_PP_ENDIF); }
-#line 4534 "strict_cpp_re.hpp"
+#line 4529 "strict_cpp_re.hpp"
 yy661:
     yych = *++YYCURSOR;
     if (yych == 'g') goto yy769;
     goto yy100;
 yy662:
     ++YYCURSOR;
-#line 334 "strict_cpp.re"
+#line 328 "strict_cpp.re"
     { WAVE_RET(T_PP_ERROR); }
-#line 4543 "strict_cpp_re.hpp"
+#line 4538 "strict_cpp_re.hpp"
 yy664:
     ++YYCURSOR;
-#line 326 "strict_cpp.re"
+#line 320 "strict_cpp.re"
     { WAVE_RET(T_PP_IFDEF); }
-#line 4548 "strict_cpp_re.hpp"
+#line 4543 "strict_cpp_re.hpp"
 yy666:
     yych = *++YYCURSOR;
     if (yych == 'f') goto yy770;
@@ -4560,9 +4558,9 @@ yy669:
     goto yy100;
 yy670:
     ++YYCURSOR;
-#line 332 "strict_cpp.re"
+#line 326 "strict_cpp.re"
     { WAVE_RET(T_PP_UNDEF); }
-#line 4569 "strict_cpp_re.hpp"
+#line 4564 "strict_cpp_re.hpp"
 yy672:
     yych = *++YYCURSOR;
     if (yych == 'n') goto yy777;
@@ -4585,12 +4583,12 @@ yy674:
     ++YYCURSOR;
 #line 252 "strict_cpp.re"
     { WAVE_RET(T_OROR_TRIGRAPH); }
-#line 4592 "strict_cpp_re.hpp"
+#line 4587 "strict_cpp_re.hpp"
 yy676:
     ++YYCURSOR;
 #line 164 "strict_cpp.re"
     { WAVE_RET(T_POUND_POUND_TRIGRAPH); }
-#line 4597 "strict_cpp_re.hpp"
+#line 4592 "strict_cpp_re.hpp"
 yy678:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4627,7 +4625,7 @@ yy683:
 yy684:
 #line 130 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_INT8 : T_IDENTIFIER); }
-#line 4634 "strict_cpp_re.hpp"
+#line 4629 "strict_cpp_re.hpp"
 yy685:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4644,7 +4642,7 @@ yy686:
 yy687:
 #line 134 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_BASED : T_IDENTIFIER); }
-#line 4651 "strict_cpp_re.hpp"
+#line 4646 "strict_cpp_re.hpp"
 yy688:
     yyaccept = 53;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4656,7 +4654,7 @@ yy688:
 yy689:
 #line 136 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_CDECL : T_IDENTIFIER); }
-#line 4663 "strict_cpp_re.hpp"
+#line 4658 "strict_cpp_re.hpp"
 yy690:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4698,7 +4696,7 @@ yy696:
 yy697:
 #line 223 "strict_cpp.re"
     { WAVE_RET(s->act_in_c99_mode ? T_IDENTIFIER : T_ANDASSIGN_ALT); }
-#line 4705 "strict_cpp_re.hpp"
+#line 4700 "strict_cpp_re.hpp"
 yy698:
     yyaccept = 55;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4710,7 +4708,7 @@ yy698:
 yy699:
 #line 202 "strict_cpp.re"
     { WAVE_RET(s->act_in_c99_mode ? T_IDENTIFIER : T_AND_ALT); }
-#line 4717 "strict_cpp_re.hpp"
+#line 4712 "strict_cpp_re.hpp"
 yy700:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4788,7 +4786,7 @@ yy713:
 yy714:
 #line 72 "strict_cpp.re"
     { WAVE_RET(T_DELETE); }
-#line 4795 "strict_cpp_re.hpp"
+#line 4790 "strict_cpp_re.hpp"
 yy715:
     yyaccept = 57;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4800,7 +4798,7 @@ yy715:
 yy716:
 #line 74 "strict_cpp.re"
     { WAVE_RET(T_DOUBLE); }
-#line 4807 "strict_cpp_re.hpp"
+#line 4802 "strict_cpp_re.hpp"
 yy717:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4822,7 +4820,7 @@ yy719:
 yy720:
 #line 79 "strict_cpp.re"
     { WAVE_RET(T_EXPORT); }
-#line 4829 "strict_cpp_re.hpp"
+#line 4824 "strict_cpp_re.hpp"
 yy721:
     yyaccept = 59;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4834,7 +4832,7 @@ yy721:
 yy722:
 #line 80 "strict_cpp.re"
     { WAVE_RET(T_EXTERN); }
-#line 4841 "strict_cpp_re.hpp"
+#line 4836 "strict_cpp_re.hpp"
 yy723:
     yyaccept = 60;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4846,7 +4844,7 @@ yy723:
 yy724:
 #line 84 "strict_cpp.re"
     { WAVE_RET(T_FRIEND); }
-#line 4853 "strict_cpp_re.hpp"
+#line 4848 "strict_cpp_re.hpp"
 yy725:
     yyaccept = 61;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4858,7 +4856,7 @@ yy725:
 yy726:
 #line 87 "strict_cpp.re"
     { WAVE_RET(s->enable_import_keyword ? T_IMPORT : T_IDENTIFIER); }
-#line 4865 "strict_cpp_re.hpp"
+#line 4860 "strict_cpp_re.hpp"
 yy727:
     yyaccept = 62;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4870,7 +4868,7 @@ yy727:
 yy728:
 #line 88 "strict_cpp.re"
     { WAVE_RET(T_INLINE); }
-#line 4877 "strict_cpp_re.hpp"
+#line 4872 "strict_cpp_re.hpp"
 yy729:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4897,7 +4895,7 @@ yy732:
 yy733:
 #line 233 "strict_cpp.re"
     { WAVE_RET(s->act_in_c99_mode ? T_IDENTIFIER : T_NOTEQUAL_ALT); }
-#line 4904 "strict_cpp_re.hpp"
+#line 4899 "strict_cpp_re.hpp"
 yy734:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4929,7 +4927,7 @@ yy738:
 yy739:
 #line 99 "strict_cpp.re"
     { WAVE_RET(T_PUBLIC); }
-#line 4936 "strict_cpp_re.hpp"
+#line 4931 "strict_cpp_re.hpp"
 yy740:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4956,7 +4954,7 @@ yy743:
 yy744:
 #line 103 "strict_cpp.re"
     { WAVE_RET(T_RETURN); }
-#line 4963 "strict_cpp_re.hpp"
+#line 4958 "strict_cpp_re.hpp"
 yy745:
     yyaccept = 66;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4968,7 +4966,7 @@ yy745:
 yy746:
 #line 105 "strict_cpp.re"
     { WAVE_RET(T_SIGNED); }
-#line 4975 "strict_cpp_re.hpp"
+#line 4970 "strict_cpp_re.hpp"
 yy747:
     yyaccept = 67;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -4980,7 +4978,7 @@ yy747:
 yy748:
 #line 106 "strict_cpp.re"
     { WAVE_RET(T_SIZEOF); }
-#line 4987 "strict_cpp_re.hpp"
+#line 4982 "strict_cpp_re.hpp"
 yy749:
     yyaccept = 68;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5004,7 +5002,7 @@ yy749:
 yy750:
 #line 107 "strict_cpp.re"
     { WAVE_RET(T_STATIC); }
-#line 5011 "strict_cpp_re.hpp"
+#line 5006 "strict_cpp_re.hpp"
 yy751:
     yyaccept = 69;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5016,7 +5014,7 @@ yy751:
 yy752:
 #line 110 "strict_cpp.re"
     { WAVE_RET(T_STRUCT); }
-#line 5023 "strict_cpp_re.hpp"
+#line 5018 "strict_cpp_re.hpp"
 yy753:
     yyaccept = 70;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5028,7 +5026,7 @@ yy753:
 yy754:
 #line 111 "strict_cpp.re"
     { WAVE_RET(T_SWITCH); }
-#line 5035 "strict_cpp_re.hpp"
+#line 5030 "strict_cpp_re.hpp"
 yy755:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5055,7 +5053,7 @@ yy758:
 yy759:
 #line 119 "strict_cpp.re"
     { WAVE_RET(T_TYPEID); }
-#line 5062 "strict_cpp_re.hpp"
+#line 5057 "strict_cpp_re.hpp"
 yy760:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5092,35 +5090,35 @@ yy765:
 yy766:
 #line 220 "strict_cpp.re"
     { WAVE_RET(s->act_in_c99_mode ? T_IDENTIFIER : T_XORASSIGN_ALT); }
-#line 5099 "strict_cpp_re.hpp"
+#line 5094 "strict_cpp_re.hpp"
 yy767:
     ++YYCURSOR;
-#line 331 "strict_cpp.re"
+#line 325 "strict_cpp.re"
     { WAVE_RET(T_PP_DEFINE); }
-#line 5104 "strict_cpp_re.hpp"
+#line 5099 "strict_cpp_re.hpp"
 yy769:
     yych = *++YYCURSOR;
     if (yych == 'i') goto yy841;
     goto yy100;
 yy770:
     ++YYCURSOR;
-#line 327 "strict_cpp.re"
+#line 321 "strict_cpp.re"
     { WAVE_RET(T_PP_IFNDEF); }
-#line 5113 "strict_cpp_re.hpp"
+#line 5108 "strict_cpp_re.hpp"
 yy772:
     yych = *++YYCURSOR;
     if (yych == 'e') goto yy842;
     goto yy100;
 yy773:
     ++YYCURSOR;
-#line 335 "strict_cpp.re"
+#line 329 "strict_cpp.re"
     { WAVE_RET(T_PP_PRAGMA); }
-#line 5122 "strict_cpp_re.hpp"
+#line 5117 "strict_cpp_re.hpp"
 yy775:
     ++YYCURSOR;
-#line 339 "strict_cpp.re"
+#line 333 "strict_cpp.re"
     { WAVE_RET(T_MSEXT_PP_REGION); }
-#line 5127 "strict_cpp_re.hpp"
+#line 5122 "strict_cpp_re.hpp"
 yy777:
     yych = *++YYCURSOR;
     if (yych == 'g') goto yy844;
@@ -5146,7 +5144,7 @@ yy780:
 yy781:
 #line 131 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_INT16 : T_IDENTIFIER); }
-#line 5153 "strict_cpp_re.hpp"
+#line 5148 "strict_cpp_re.hpp"
 yy782:
     yyaccept = 74;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5158,7 +5156,7 @@ yy782:
 yy783:
 #line 132 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_INT32 : T_IDENTIFIER); }
-#line 5165 "strict_cpp_re.hpp"
+#line 5160 "strict_cpp_re.hpp"
 yy784:
     yyaccept = 75;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5170,7 +5168,7 @@ yy784:
 yy785:
 #line 133 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_INT64 : T_IDENTIFIER); }
-#line 5177 "strict_cpp_re.hpp"
+#line 5172 "strict_cpp_re.hpp"
 yy786:
     yyaccept = 76;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5182,7 +5180,7 @@ yy786:
 yy787:
 #line 142 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_LEAVE : T_IDENTIFIER); }
-#line 5189 "strict_cpp_re.hpp"
+#line 5184 "strict_cpp_re.hpp"
 yy788:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5204,7 +5202,7 @@ yy790:
 yy791:
 #line 143 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_INLINE : T_IDENTIFIER); }
-#line 5211 "strict_cpp_re.hpp"
+#line 5206 "strict_cpp_re.hpp"
 yy792:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5221,7 +5219,7 @@ yy793:
 yy794:
 #line 47 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp0x_mode ? T_ALIGNAS : T_IDENTIFIER); }
-#line 5228 "strict_cpp_re.hpp"
+#line 5223 "strict_cpp_re.hpp"
 yy795:
     yyaccept = 79;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5233,7 +5231,7 @@ yy795:
 yy796:
 #line 48 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp0x_mode ? T_ALIGNOF : T_IDENTIFIER); }
-#line 5240 "strict_cpp_re.hpp"
+#line 5235 "strict_cpp_re.hpp"
 yy797:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5255,7 +5253,7 @@ yy799:
 yy800:
 #line 56 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp2a_mode ? T_CHAR8_T : T_IDENTIFIER); }
-#line 5262 "strict_cpp_re.hpp"
+#line 5257 "strict_cpp_re.hpp"
 yy801:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5282,7 +5280,7 @@ yy804:
 yy805:
 #line 60 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp2a_mode ? T_CONCEPT : T_IDENTIFIER); }
-#line 5289 "strict_cpp_re.hpp"
+#line 5284 "strict_cpp_re.hpp"
 yy806:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5324,7 +5322,7 @@ yy812:
 yy813:
 #line 71 "strict_cpp.re"
     { WAVE_RET(T_DEFAULT); }
-#line 5331 "strict_cpp_re.hpp"
+#line 5326 "strict_cpp_re.hpp"
 yy814:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5346,7 +5344,7 @@ yy816:
 yy817:
 #line 91 "strict_cpp.re"
     { WAVE_RET(T_MUTABLE); }
-#line 5353 "strict_cpp_re.hpp"
+#line 5348 "strict_cpp_re.hpp"
 yy818:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5368,7 +5366,7 @@ yy820:
 yy821:
 #line 95 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp0x_mode ? T_NULLPTR : T_IDENTIFIER); }
-#line 5375 "strict_cpp_re.hpp"
+#line 5370 "strict_cpp_re.hpp"
 yy822:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5385,7 +5383,7 @@ yy823:
 yy824:
 #line 97 "strict_cpp.re"
     { WAVE_RET(T_PRIVATE); }
-#line 5392 "strict_cpp_re.hpp"
+#line 5387 "strict_cpp_re.hpp"
 yy825:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5433,7 +5431,7 @@ yy832:
 yy833:
 #line 118 "strict_cpp.re"
     { WAVE_RET(T_TYPEDEF); }
-#line 5440 "strict_cpp_re.hpp"
+#line 5435 "strict_cpp_re.hpp"
 yy834:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5455,7 +5453,7 @@ yy836:
 yy837:
 #line 124 "strict_cpp.re"
     { WAVE_RET(T_VIRTUAL); }
-#line 5462 "strict_cpp_re.hpp"
+#line 5457 "strict_cpp_re.hpp"
 yy838:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5472,7 +5470,7 @@ yy839:
 yy840:
 #line 127 "strict_cpp.re"
     { WAVE_RET(T_WCHART); }
-#line 5479 "strict_cpp_re.hpp"
+#line 5474 "strict_cpp_re.hpp"
 yy841:
     yych = *++YYCURSOR;
     if (yych == 'o') goto yy895;
@@ -5483,14 +5481,14 @@ yy842:
     if (yych == '_') goto yy901;
     goto yy897;
 yy843:
-#line 323 "strict_cpp.re"
+#line 317 "strict_cpp.re"
     { WAVE_RET(T_PP_INCLUDE); }
-#line 5492 "strict_cpp_re.hpp"
+#line 5487 "strict_cpp_re.hpp"
 yy844:
     ++YYCURSOR;
-#line 337 "strict_cpp.re"
+#line 331 "strict_cpp.re"
     { WAVE_RET(T_PP_WARNING); }
-#line 5497 "strict_cpp_re.hpp"
+#line 5492 "strict_cpp_re.hpp"
 yy846:
     yyaccept = 90;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5502,7 +5500,7 @@ yy846:
 yy847:
 #line 140 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_EXCEPT : T_IDENTIFIER); }
-#line 5509 "strict_cpp_re.hpp"
+#line 5504 "strict_cpp_re.hpp"
 yy848:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5529,7 +5527,7 @@ yy851:
 yy852:
 #line 138 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_STDCALL : T_IDENTIFIER); }
-#line 5536 "strict_cpp_re.hpp"
+#line 5531 "strict_cpp_re.hpp"
 yy853:
     yyaccept = 92;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5541,7 +5539,7 @@ yy853:
 yy854:
 #line 57 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp0x_mode ? T_CHAR16_T : T_IDENTIFIER); }
-#line 5548 "strict_cpp_re.hpp"
+#line 5543 "strict_cpp_re.hpp"
 yy855:
     yyaccept = 93;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5553,7 +5551,7 @@ yy855:
 yy856:
 #line 58 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp0x_mode ? T_CHAR32_T : T_IDENTIFIER); }
-#line 5560 "strict_cpp_re.hpp"
+#line 5555 "strict_cpp_re.hpp"
 yy857:
     yyaccept = 94;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5565,7 +5563,7 @@ yy857:
 yy858:
 #line 67 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp2a_mode ? T_CO_AWAIT : T_IDENTIFIER); }
-#line 5572 "strict_cpp_re.hpp"
+#line 5567 "strict_cpp_re.hpp"
 yy859:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5582,7 +5580,7 @@ yy860:
 yy861:
 #line 69 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp2a_mode ? T_CO_YIELD : T_IDENTIFIER); }
-#line 5589 "strict_cpp_re.hpp"
+#line 5584 "strict_cpp_re.hpp"
 yy862:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5614,7 +5612,7 @@ yy866:
 yy867:
 #line 66 "strict_cpp.re"
     { WAVE_RET(T_CONTINUE); }
-#line 5621 "strict_cpp_re.hpp"
+#line 5616 "strict_cpp_re.hpp"
 yy868:
     yyaccept = 97;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5626,7 +5624,7 @@ yy868:
 yy869:
 #line 70 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp0x_mode ? T_DECLTYPE : T_IDENTIFIER); }
-#line 5633 "strict_cpp_re.hpp"
+#line 5628 "strict_cpp_re.hpp"
 yy870:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5643,7 +5641,7 @@ yy871:
 yy872:
 #line 78 "strict_cpp.re"
     { WAVE_RET(T_EXPLICIT); }
-#line 5650 "strict_cpp_re.hpp"
+#line 5645 "strict_cpp_re.hpp"
 yy873:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5660,7 +5658,7 @@ yy874:
 yy875:
 #line 94 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp0x_mode ? T_NOEXCEPT : T_IDENTIFIER); }
-#line 5667 "strict_cpp_re.hpp"
+#line 5662 "strict_cpp_re.hpp"
 yy876:
     yyaccept = 100;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5672,7 +5670,7 @@ yy876:
 yy877:
 #line 96 "strict_cpp.re"
     { WAVE_RET(T_OPERATOR); }
-#line 5679 "strict_cpp_re.hpp"
+#line 5674 "strict_cpp_re.hpp"
 yy878:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5689,7 +5687,7 @@ yy879:
 yy880:
 #line 100 "strict_cpp.re"
     { WAVE_RET(T_REGISTER); }
-#line 5696 "strict_cpp_re.hpp"
+#line 5691 "strict_cpp_re.hpp"
 yy881:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5706,7 +5704,7 @@ yy882:
 yy883:
 #line 102 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp2a_mode ? T_REQUIRES : T_IDENTIFIER); }
-#line 5713 "strict_cpp_re.hpp"
+#line 5708 "strict_cpp_re.hpp"
 yy884:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5728,7 +5726,7 @@ yy886:
 yy887:
 #line 112 "strict_cpp.re"
     { WAVE_RET(T_TEMPLATE); }
-#line 5735 "strict_cpp_re.hpp"
+#line 5730 "strict_cpp_re.hpp"
 yy888:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5745,7 +5743,7 @@ yy889:
 yy890:
 #line 120 "strict_cpp.re"
     { WAVE_RET(T_TYPENAME); }
-#line 5752 "strict_cpp_re.hpp"
+#line 5747 "strict_cpp_re.hpp"
 yy891:
     yyaccept = 105;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5757,7 +5755,7 @@ yy891:
 yy892:
 #line 122 "strict_cpp.re"
     { WAVE_RET(T_UNSIGNED); }
-#line 5764 "strict_cpp_re.hpp"
+#line 5759 "strict_cpp_re.hpp"
 yy893:
     yyaccept = 106;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5769,7 +5767,7 @@ yy893:
 yy894:
 #line 126 "strict_cpp.re"
     { WAVE_RET(T_VOLATILE); }
-#line 5776 "strict_cpp_re.hpp"
+#line 5771 "strict_cpp_re.hpp"
 yy895:
     yych = *++YYCURSOR;
     if (yych == 'n') goto yy926;
@@ -5826,7 +5824,7 @@ yy902:
 yy903:
 #line 141 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_FINALLY : T_IDENTIFIER); }
-#line 5833 "strict_cpp_re.hpp"
+#line 5828 "strict_cpp_re.hpp"
 yy904:
     yyaccept = 108;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5838,7 +5836,7 @@ yy904:
 yy905:
 #line 135 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_DECLSPEC : T_IDENTIFIER); }
-#line 5845 "strict_cpp_re.hpp"
+#line 5840 "strict_cpp_re.hpp"
 yy906:
     yyaccept = 109;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5850,7 +5848,7 @@ yy906:
 yy907:
 #line 137 "strict_cpp.re"
     { WAVE_RET(s->enable_ms_extensions ? T_MSEXT_FASTCALL : T_IDENTIFIER); }
-#line 5857 "strict_cpp_re.hpp"
+#line 5852 "strict_cpp_re.hpp"
 yy908:
     yyaccept = 110;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5862,7 +5860,7 @@ yy908:
 yy909:
 #line 68 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp2a_mode ? T_CO_RETURN : T_IDENTIFIER); }
-#line 5869 "strict_cpp_re.hpp"
+#line 5864 "strict_cpp_re.hpp"
 yy910:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5879,7 +5877,7 @@ yy911:
 yy912:
 #line 62 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp2a_mode ? T_CONSTEVAL : T_IDENTIFIER); }
-#line 5886 "strict_cpp_re.hpp"
+#line 5881 "strict_cpp_re.hpp"
 yy913:
     yyaccept = 112;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5891,7 +5889,7 @@ yy913:
 yy914:
 #line 63 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp0x_mode ? T_CONSTEXPR : T_IDENTIFIER); }
-#line 5898 "strict_cpp_re.hpp"
+#line 5893 "strict_cpp_re.hpp"
 yy915:
     yyaccept = 113;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5903,7 +5901,7 @@ yy915:
 yy916:
 #line 64 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp2a_mode ? T_CONSTINIT : T_IDENTIFIER); }
-#line 5910 "strict_cpp_re.hpp"
+#line 5905 "strict_cpp_re.hpp"
 yy917:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5920,7 +5918,7 @@ yy918:
 yy919:
 #line 92 "strict_cpp.re"
     { WAVE_RET(T_NAMESPACE); }
-#line 5927 "strict_cpp_re.hpp"
+#line 5922 "strict_cpp_re.hpp"
 yy920:
     yyaccept = 115;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5932,7 +5930,7 @@ yy920:
 yy921:
 #line 98 "strict_cpp.re"
     { WAVE_RET(T_PROTECTED); }
-#line 5939 "strict_cpp_re.hpp"
+#line 5934 "strict_cpp_re.hpp"
 yy922:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -5955,9 +5953,9 @@ yy925:
     goto yy55;
 yy926:
     ++YYCURSOR;
-#line 340 "strict_cpp.re"
+#line 334 "strict_cpp.re"
     { WAVE_RET(T_MSEXT_PP_ENDREGION); }
-#line 5964 "strict_cpp_re.hpp"
+#line 5959 "strict_cpp_re.hpp"
 yy928:
     ++YYCURSOR;
     if (YYLIMIT <= YYCURSOR) YYFILL(1);
@@ -6005,7 +6003,7 @@ yy935:
 yy936:
 #line 65 "strict_cpp.re"
     { WAVE_RET(T_CONSTCAST); }
-#line 6012 "strict_cpp_re.hpp"
+#line 6007 "strict_cpp_re.hpp"
 yy937:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -6033,9 +6031,9 @@ yy941:
     goto yy55;
 yy942:
     ++YYCURSOR;
-#line 320 "strict_cpp.re"
+#line 314 "strict_cpp.re"
     { WAVE_RET(T_PP_QHEADER); }
-#line 6042 "strict_cpp_re.hpp"
+#line 6037 "strict_cpp_re.hpp"
 yy944:
     ++YYCURSOR;
     if (YYLIMIT <= YYCURSOR) YYFILL(1);
@@ -6052,9 +6050,9 @@ yy944:
     }
 yy946:
     ++YYCURSOR;
-#line 317 "strict_cpp.re"
+#line 311 "strict_cpp.re"
     { WAVE_RET(T_PP_HHEADER); }
-#line 6061 "strict_cpp_re.hpp"
+#line 6056 "strict_cpp_re.hpp"
 yy948:
     yych = *++YYCURSOR;
     if (yych == 'x') goto yy955;
@@ -6085,7 +6083,7 @@ yy952:
 yy953:
 #line 108 "strict_cpp.re"
     { WAVE_RET(T_STATICCAST); }
-#line 6092 "strict_cpp_re.hpp"
+#line 6087 "strict_cpp_re.hpp"
 yy954:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -6106,7 +6104,7 @@ yy956:
 yy957:
 #line 75 "strict_cpp.re"
     { WAVE_RET(T_DYNAMICCAST); }
-#line 6113 "strict_cpp_re.hpp"
+#line 6108 "strict_cpp_re.hpp"
 yy958:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -6128,7 +6126,7 @@ yy960:
 yy961:
 #line 114 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp0x_mode ? T_THREADLOCAL : T_IDENTIFIER); }
-#line 6135 "strict_cpp_re.hpp"
+#line 6130 "strict_cpp_re.hpp"
 yy962:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -6145,7 +6143,7 @@ yy963:
 yy964:
 #line 109 "strict_cpp.re"
     { WAVE_RET(s->act_in_cpp0x_mode ? T_STATICASSERT : T_IDENTIFIER); }
-#line 6152 "strict_cpp_re.hpp"
+#line 6147 "strict_cpp_re.hpp"
 yy965:
     yyaccept = 4;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -6163,14 +6161,16 @@ yy965:
 yy968:
 #line 101 "strict_cpp.re"
     { WAVE_RET(T_REINTERPRETCAST); }
-#line 6170 "strict_cpp_re.hpp"
+#line 6165 "strict_cpp_re.hpp"
 }
-#line 372 "strict_cpp.re"
+#line 370 "strict_cpp.re"
 
 
 ccomment:
+    // skip the text not relevant for the rules below
+    skip_comment_text(cursor, limit, '*');
 
-#line 6177 "strict_cpp_re.hpp"
+#line 6174 "strict_cpp_re.hpp"
 {
     YYCTYPE yych;
     if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
@@ -6199,6 +6199,7 @@ ccomment:
             WAVE_UPDATE_CURSOR();   // adjust the input cursor
             (*s->error_proc)(s, lexing_exception::generic_lexing_warning,
                 "Unterminated 'C' style comment");
+            --YYCURSOR;                   // next call returns T_EOF
         }
         else
         {
@@ -6207,24 +6208,31 @@ ccomment:
             (*s->error_proc)(s, lexing_exception::generic_lexing_error,
                 "invalid character: '\\000' in input stream");
         }
+
+        // the diagnostic was reported to an error sink, return the comment
+        WAVE_RET(T_CCOMMENT);
     }
-#line 6215 "strict_cpp_re.hpp"
+#line 6216 "strict_cpp_re.hpp"
 yy973:
     ++YYCURSOR;
-#line 407 "strict_cpp.re"
+#line 411 "strict_cpp.re"
     {
         // flag the error
         WAVE_UPDATE_CURSOR();   // adjust the input cursor
         (*s->error_proc)(s, lexing_exception::generic_lexing_error,
             "invalid character '\\%03o' in input stream", *--YYCURSOR);
+
+        // the error was reported to an error sink, skip the character
+        ++YYCURSOR;
+        goto ccomment;
     }
-#line 6225 "strict_cpp_re.hpp"
+#line 6230 "strict_cpp_re.hpp"
 yy975:
     ++YYCURSOR;
 yy976:
 #line 387 "strict_cpp.re"
     { goto ccomment; }
-#line 6231 "strict_cpp_re.hpp"
+#line 6236 "strict_cpp_re.hpp"
 yy977:
     ++YYCURSOR;
 yy978:
@@ -6233,10 +6241,10 @@ yy978:
         /*if(cursor == s->eof) WAVE_RET(T_EOF);*/
         /*s->tok = cursor; */
         s->line += count_backslash_newlines(s, cursor) +1;
-        cursor.column = 1;
+        set_column(cursor, 1);
         goto ccomment;
     }
-#line 6243 "strict_cpp_re.hpp"
+#line 6248 "strict_cpp_re.hpp"
 yy979:
     yych = *++YYCURSOR;
     if (yych == '\n') goto yy977;
@@ -6247,14 +6255,15 @@ yy980:
     ++YYCURSOR;
 #line 376 "strict_cpp.re"
     { WAVE_RET(T_CCOMMENT); }
-#line 6254 "strict_cpp_re.hpp"
+#line 6259 "strict_cpp_re.hpp"
 }
-#line 413 "strict_cpp.re"
+#line 421 "strict_cpp.re"
 
 
 cppcomment:
+    skip_comment_text(cursor, limit, '\n');
 
-#line 6261 "strict_cpp_re.hpp"
+#line 6267 "strict_cpp_re.hpp"
 {
     YYCTYPE yych;
     if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
@@ -6272,7 +6281,7 @@ cppcomment:
     }
 yy985:
     ++YYCURSOR;
-#line 429 "strict_cpp.re"
+#line 438 "strict_cpp.re"
     {
         if (s->eof && cursor != s->eof)
         {
@@ -6291,52 +6300,56 @@ yy985:
         }
         WAVE_RET(T_CPPCOMMENT);
     }
-#line 6298 "strict_cpp_re.hpp"
+#line 6304 "strict_cpp_re.hpp"
 yy987:
     ++YYCURSOR;
-#line 449 "strict_cpp.re"
+#line 458 "strict_cpp.re"
     {
         // flag the error
         WAVE_UPDATE_CURSOR();     // adjust the input cursor
         (*s->error_proc)(s, lexing_exception::generic_lexing_error,
             "invalid character '\\%03o' in input stream", *--YYCURSOR);
+
+        // the error was reported to an error sink, skip the character
+        ++YYCURSOR;
+        goto cppcomment;
     }
-#line 6308 "strict_cpp_re.hpp"
+#line 6318 "strict_cpp_re.hpp"
 yy989:
     ++YYCURSOR;
-#line 426 "strict_cpp.re"
+#line 435 "strict_cpp.re"
     { goto cppcomment; }
-#line 6313 "strict_cpp_re.hpp"
+#line 6323 "strict_cpp_re.hpp"
 yy991:
     ++YYCURSOR;
 yy992:
-#line 418 "strict_cpp.re"
+#line 427 "strict_cpp.re"
     {
         /*if(cursor == s->eof) WAVE_RET(T_EOF); */
         /*s->tok = cursor; */
         s->line++;
-        cursor.column = 1;
+        set_column(cursor, 1);
         WAVE_RET(T_CPPCOMMENT);
     }
-#line 6325 "strict_cpp_re.hpp"
+#line 6335 "strict_cpp_re.hpp"
 yy993:
     yych = *++YYCURSOR;
     if (yych == '\n') goto yy991;
     goto yy992;
 }
-#line 455 "strict_cpp.re"
+#line 468 "strict_cpp.re"
 
 
 /* this subscanner is called whenever a pp_number has been started */
 pp_number:
 {
-    cursor = uchar_wrapper(s->tok = s->cur, s->column = s->curr_column);
-    marker = uchar_wrapper(s->ptr);
-    limit = uchar_wrapper(s->lim);
+    cursor = make_cursor<Cursor>(s->tok = s->cur, s->column = s->curr_column);
+    marker = make_cursor<Cursor>(s->ptr, 1);
+    limit = make_cursor<Cursor>(s->lim, 1);
 
     if (s->detect_pp_numbers) {
     
-#line 6343 "strict_cpp_re.hpp"
+#line 6353 "strict_cpp_re.hpp"
 {
     YYCTYPE yych;
     static const unsigned char yybm[] = {
@@ -6381,9 +6394,9 @@ pp_number:
 yy996:
     ++YYCURSOR;
 yy997:
-#line 469 "strict_cpp.re"
+#line 482 "strict_cpp.re"
     { assert(false); }
-#line 6390 "strict_cpp_re.hpp"
+#line 6400 "strict_cpp_re.hpp"
 yy998:
     yych = *++YYCURSOR;
     if (yych <= '/') goto yy997;
@@ -6407,9 +6420,9 @@ yy999:
         }
     }
 yy1001:
-#line 467 "strict_cpp.re"
+#line 480 "strict_cpp.re"
     { WAVE_RET(T_PP_NUMBER); }
-#line 6416 "strict_cpp_re.hpp"
+#line 6426 "strict_cpp_re.hpp"
 yy1002:
     ++YYCURSOR;
     if (YYLIMIT <= YYCURSOR) YYFILL(1);
@@ -6578,12 +6591,12 @@ yy1015:
         goto yy1003;
     }
 }
-#line 470 "strict_cpp.re"
+#line 483 "strict_cpp.re"
 
     }
     else {
     
-#line 6590 "strict_cpp_re.hpp"
+#line 6600 "strict_cpp_re.hpp"
 {
     YYCTYPE yych;
     unsigned int yyaccept = 0;
@@ -6631,9 +6644,9 @@ yy1015:
     }
     ++YYCURSOR;
 yy1019:
-#line 479 "strict_cpp.re"
+#line 492 "strict_cpp.re"
     { assert(false); }
-#line 6640 "strict_cpp_re.hpp"
+#line 6650 "strict_cpp_re.hpp"
 yy1020:
     yych = *++YYCURSOR;
     if (yych <= '/') goto yy1019;
@@ -6646,9 +6659,9 @@ yy1021:
     if (yych == 'x') goto yy1034;
     goto yy1029;
 yy1022:
-#line 477 "strict_cpp.re"
+#line 490 "strict_cpp.re"
     { goto integer_suffix; }
-#line 6655 "strict_cpp_re.hpp"
+#line 6665 "strict_cpp_re.hpp"
 yy1023:
     yyaccept = 0;
     YYMARKER = ++YYCURSOR;
@@ -6687,9 +6700,9 @@ yy1025:
         }
     }
 yy1027:
-#line 475 "strict_cpp.re"
+#line 488 "strict_cpp.re"
     { WAVE_RET(T_FLOATLIT); }
-#line 6696 "strict_cpp_re.hpp"
+#line 6706 "strict_cpp_re.hpp"
 yy1028:
     yyaccept = 0;
     YYMARKER = ++YYCURSOR;
@@ -6797,7 +6810,7 @@ yy1042:
     ++YYCURSOR;
     goto yy1027;
 }
-#line 480 "strict_cpp.re"
+#line 493 "strict_cpp.re"
 
     }
 }
@@ -6807,7 +6820,7 @@ integer_suffix:
 {
     if (s->enable_ms_extensions) {
     
-#line 6814 "strict_cpp_re.hpp"
+#line 6824 "strict_cpp_re.hpp"
 {
     YYCTYPE yych;
     if ((YYLIMIT - YYCURSOR) < 3) YYFILL(3);
@@ -6827,9 +6840,9 @@ integer_suffix:
         }
     }
 yy1045:
-#line 493 "strict_cpp.re"
+#line 506 "strict_cpp.re"
     { WAVE_RET(T_INTLIT); }
-#line 6836 "strict_cpp_re.hpp"
+#line 6846 "strict_cpp_re.hpp"
 yy1046:
     yych = *++YYCURSOR;
     if (yych <= 'T') {
@@ -6866,9 +6879,9 @@ yy1051:
     if (yych == 'U') goto yy1057;
     if (yych == 'u') goto yy1057;
 yy1052:
-#line 490 "strict_cpp.re"
+#line 503 "strict_cpp.re"
     { WAVE_RET(T_LONGINTLIT); }
-#line 6875 "strict_cpp_re.hpp"
+#line 6885 "strict_cpp_re.hpp"
 yy1053:
     ++YYCURSOR;
     goto yy1045;
@@ -6887,12 +6900,12 @@ yy1057:
     ++YYCURSOR;
     goto yy1052;
 }
-#line 494 "strict_cpp.re"
+#line 507 "strict_cpp.re"
 
     }
     else {
     
-#line 6899 "strict_cpp_re.hpp"
+#line 6909 "strict_cpp_re.hpp"
 {
     YYCTYPE yych;
     if ((YYLIMIT - YYCURSOR) < 3) YYFILL(3);
@@ -6908,9 +6921,9 @@ yy1057:
         }
     }
 yy1060:
-#line 502 "strict_cpp.re"
+#line 515 "strict_cpp.re"
     { WAVE_RET(T_INTLIT); }
-#line 6917 "strict_cpp_re.hpp"
+#line 6927 "strict_cpp_re.hpp"
 yy1061:
     yych = *++YYCURSOR;
     if (yych <= 'T') {
@@ -6941,9 +6954,9 @@ yy1064:
     if (yych == 'U') goto yy1069;
     if (yych == 'u') goto yy1069;
 yy1065:
-#line 499 "strict_cpp.re"
+#line 512 "strict_cpp.re"
     { WAVE_RET(T_LONGINTLIT); }
-#line 6950 "strict_cpp_re.hpp"
+#line 6960 "strict_cpp_re.hpp"
 yy1066:
     ++YYCURSOR;
     goto yy1060;
@@ -6958,7 +6971,7 @@ yy1069:
     ++YYCURSOR;
     goto yy1065;
 }
-#line 503 "strict_cpp.re"
+#line 516 "strict_cpp.re"
 
     }
 
@@ -6971,7 +6984,7 @@ yy1069:
 extcharlit:
 {
     
-#line 6978 "strict_cpp_re.hpp"
+#line 6988 "strict_cpp_re.hpp"
 {
     YYCTYPE yych;
     static const unsigned char yybm[] = {
@@ -7031,19 +7044,22 @@ extcharlit:
     }
 yy1072:
     ++YYCURSOR;
-#line 515 "strict_cpp.re"
+#line 528 "strict_cpp.re"
     {
             (*s->error_proc)(s, lexing_exception::generic_lexing_error,
                 "Invalid character in raw string delimiter ('%c')", yych);
+
+            // the error was reported to an error sink
+            WAVE_RET(TOKEN_FROM_ID(*s->tok, UnknownTokenType));
         }
-#line 7043 "strict_cpp_re.hpp"
+#line 7056 "strict_cpp_re.hpp"
 yy1074:
     yych = *++YYCURSOR;
     if (yych == '\'') goto yy1079;
 yy1075:
-#line 524 "strict_cpp.re"
+#line 540 "strict_cpp.re"
     { WAVE_RET(TOKEN_FROM_ID(*s->tok, UnknownTokenType)); }
-#line 7050 "strict_cpp_re.hpp"
+#line 7063 "strict_cpp_re.hpp"
 yy1076:
     ++YYCURSOR;
     goto yy1075;
@@ -7099,9 +7115,9 @@ yy1078:
     }
 yy1079:
     ++YYCURSOR;
-#line 521 "strict_cpp.re"
+#line 537 "strict_cpp.re"
     { WAVE_RET(T_CHARLIT); }
-#line 7108 "strict_cpp_re.hpp"
+#line 7121 "strict_cpp_re.hpp"
 yy1081:
     yych = *++YYCURSOR;
     if (yych == '/') goto yy1089;
@@ -7289,7 +7305,7 @@ yy1099:
         goto yy1082;
     }
 }
-#line 525 "strict_cpp.re"
+#line 541 "strict_cpp.re"
 
 }
 
@@ -7297,7 +7313,7 @@ yy1099:
 extstringlit:
 {
     
-#line 7304 "strict_cpp_re.hpp"
+#line 7317 "strict_cpp_re.hpp"
 {
     YYCTYPE yych;
     unsigned int yyaccept = 0;
@@ -7358,12 +7374,15 @@ extstringlit:
     }
 yy1102:
     ++YYCURSOR;
-#line 532 "strict_cpp.re"
+#line 548 "strict_cpp.re"
     {
             (*s->error_proc)(s, lexing_exception::generic_lexing_error,
                 "Invalid character in raw string delimiter ('%c')", yych);
+
+            // the error was reported to an error sink
+            WAVE_RET(TOKEN_FROM_ID(*s->tok, UnknownTokenType));
         }
-#line 7370 "strict_cpp_re.hpp"
+#line 7386 "strict_cpp_re.hpp"
 yy1104:
     yyaccept = 0;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -7374,18 +7393,18 @@ yy1104:
         if (yych >= ' ') goto yy1112;
     }
 yy1105:
-#line 541 "strict_cpp.re"
+#line 560 "strict_cpp.re"
     { WAVE_RET(TOKEN_FROM_ID(*s->tok, UnknownTokenType)); }
-#line 7383 "strict_cpp_re.hpp"
+#line 7399 "strict_cpp_re.hpp"
 yy1106:
     ++YYCURSOR;
     goto yy1105;
 yy1107:
     ++YYCURSOR;
 yy1108:
-#line 538 "strict_cpp.re"
+#line 557 "strict_cpp.re"
     { WAVE_RET(T_STRINGLIT); }
-#line 7392 "strict_cpp_re.hpp"
+#line 7408 "strict_cpp_re.hpp"
 yy1109:
     yyaccept = 0;
     yych = *(YYMARKER = ++YYCURSOR);
@@ -7677,398 +7696,16 @@ yy1128:
         goto yy1113;
     }
 }
-#line 542 "strict_cpp.re"
+#line 561 "strict_cpp.re"
 
 }
 
 extrawstringlit:
 {
-    // we have consumed the double quote but not the lparen
-    // at this point we may see a delimiter
-
-    
-#line 7694 "strict_cpp_re.hpp"
-{
-    YYCTYPE yych;
-    if (YYLIMIT <= YYCURSOR) YYFILL(1);
-    yych = *YYCURSOR;
-    if (yych <= '(') {
-        if (yych <= 0x1F) goto yy1131;
-        if (yych <= '\'') goto yy1133;
-        goto yy1135;
-    } else {
-        if (yych <= ')') goto yy1131;
-        if (yych != '\\') goto yy1133;
-    }
-yy1131:
-    ++YYCURSOR;
-#line 551 "strict_cpp.re"
-    {
-            (*s->error_proc)(s, lexing_exception::generic_lexing_error,
-                "Invalid character in raw string delimiter ('%c')", yych);
-        }
-#line 7714 "strict_cpp_re.hpp"
-yy1133:
-    ++YYCURSOR;
-#line 558 "strict_cpp.re"
-    {
-            rawstringdelim += yych;
-            if (rawstringdelim.size() > 16)
-            {
-                (*s->error_proc)(s, lexing_exception::generic_lexing_error,
-                    "Raw string delimiter of excessive length (\"%s\") in input stream",
-                    rawstringdelim.c_str());
-            }
-            goto extrawstringlit;
-        }
-#line 7728 "strict_cpp_re.hpp"
-yy1135:
-    ++YYCURSOR;
-#line 570 "strict_cpp.re"
-    {
-            rawstringdelim = ")" + rawstringdelim;
-            goto extrawstringbody;
-        }
-#line 7736 "strict_cpp_re.hpp"
-}
-#line 575 "strict_cpp.re"
-
-}
-
-extrawstringbody:
-{
-    
-#line 7745 "strict_cpp_re.hpp"
-{
-    YYCTYPE yych;
-    static const unsigned char yybm[] = {
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-        128, 128, 128, 128, 128, 128, 128, 128, 
-        128, 128,   0,   0,   0,   0,   0,   0, 
-          0, 128, 128, 128, 128, 128, 128,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0, 128, 128, 128, 128, 128, 128,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-          0,   0,   0,   0,   0,   0,   0,   0, 
-    };
-    if ((YYLIMIT - YYCURSOR) < 12) YYFILL(12);
-    yych = *YYCURSOR;
-    if (yych <= 0x1F) {
-        if (yych <= '\n') {
-            if (yych <= 0x08) goto yy1139;
-            if (yych <= '\t') goto yy1141;
-            goto yy1143;
-        } else {
-            if (yych <= '\f') goto yy1141;
-            if (yych <= '\r') goto yy1145;
-        }
-    } else {
-        if (yych <= '>') {
-            if (yych == '"') goto yy1146;
-            goto yy1141;
-        } else {
-            if (yych <= '?') goto yy1148;
-            if (yych == '\\') goto yy1149;
-            goto yy1141;
-        }
-    }
-yy1139:
-    ++YYCURSOR;
-#line 582 "strict_cpp.re"
-    {
-            (*s->error_proc)(s, lexing_exception::generic_lexing_error,
-                "Invalid character in raw string body ('%c')", yych);
-        }
-#line 7810 "strict_cpp_re.hpp"
-yy1141:
-    ++YYCURSOR;
-yy1142:
-#line 595 "strict_cpp.re"
-    {
-            goto extrawstringbody;
-        }
-#line 7818 "strict_cpp_re.hpp"
-yy1143:
-    ++YYCURSOR;
-yy1144:
-#line 588 "strict_cpp.re"
-    {
-            s->line += count_backslash_newlines(s, cursor) +1;
-            cursor.column = 1;
-            goto extrawstringbody;
-        }
-#line 7828 "strict_cpp_re.hpp"
-yy1145:
-    yych = *++YYCURSOR;
-    if (yych == '\n') goto yy1143;
-    goto yy1144;
-yy1146:
-    ++YYCURSOR;
-#line 600 "strict_cpp.re"
-    {
-            // check to see if we have completed a delimiter
-            if (string_type((char *)(YYCURSOR - rawstringdelim.size() - 1),
-                             (char *)(YYCURSOR - 1)) == rawstringdelim)
-            {
-                 WAVE_RET(T_RAWSTRINGLIT);
-            } else {
-                goto extrawstringbody;
-            }
-        }
-#line 7846 "strict_cpp_re.hpp"
-yy1148:
-    yych = *(YYMARKER = ++YYCURSOR);
-    if (yych == '?') goto yy1150;
-    goto yy1142;
-yy1149:
-    yych = *(YYMARKER = ++YYCURSOR);
-    if (yych <= '`') {
-        if (yych <= '7') {
-            if (yych <= '&') {
-                if (yych == '"') goto yy1141;
-                goto yy1142;
-            } else {
-                if (yych <= '\'') goto yy1141;
-                if (yych <= '/') goto yy1142;
-                goto yy1152;
-            }
-        } else {
-            if (yych <= 'T') {
-                if (yych == '?') goto yy1153;
-                goto yy1142;
-            } else {
-                if (yych <= 'U') goto yy1154;
-                if (yych == '\\') goto yy1141;
-                goto yy1142;
-            }
-        }
-    } else {
-        if (yych <= 'r') {
-            if (yych <= 'f') {
-                if (yych <= 'b') goto yy1141;
-                if (yych <= 'e') goto yy1142;
-                goto yy1141;
-            } else {
-                if (yych == 'n') goto yy1141;
-                if (yych <= 'q') goto yy1142;
-                goto yy1141;
-            }
-        } else {
-            if (yych <= 'u') {
-                if (yych <= 's') goto yy1142;
-                if (yych <= 't') goto yy1141;
-                goto yy1155;
-            } else {
-                if (yych <= 'v') goto yy1141;
-                if (yych == 'x') goto yy1156;
-                goto yy1142;
-            }
-        }
-    }
-yy1150:
-    yych = *++YYCURSOR;
-    if (yych == '/') goto yy1157;
-yy1151:
-    YYCURSOR = YYMARKER;
-    goto yy1142;
-yy1152:
-    yych = *++YYCURSOR;
-    if (yych <= '/') goto yy1142;
-    if (yych <= '7') goto yy1158;
-    goto yy1142;
-yy1153:
-    yych = *(YYMARKER = ++YYCURSOR);
-    if (yych == '?') goto yy1159;
-    goto yy1142;
-yy1154:
-    yych = *++YYCURSOR;
-    if (yych <= '@') {
-        if (yych <= '/') goto yy1151;
-        if (yych <= '9') goto yy1160;
-        goto yy1151;
-    } else {
-        if (yych <= 'F') goto yy1160;
-        if (yych <= '`') goto yy1151;
-        if (yych <= 'f') goto yy1160;
-        goto yy1151;
-    }
-yy1155:
-    yych = *++YYCURSOR;
-    if (yych <= '@') {
-        if (yych <= '/') goto yy1151;
-        if (yych <= '9') goto yy1161;
-        goto yy1151;
-    } else {
-        if (yych <= 'F') goto yy1161;
-        if (yych <= '`') goto yy1151;
-        if (yych <= 'f') goto yy1161;
-        goto yy1151;
-    }
-yy1156:
-    yych = *++YYCURSOR;
-    if (yybm[0+yych] & 128) {
-        goto yy1162;
-    }
-    goto yy1151;
-yy1157:
-    yych = *++YYCURSOR;
-    if (yych <= '`') {
-        if (yych <= '7') {
-            if (yych <= '&') {
-                if (yych == '"') goto yy1141;
-                goto yy1151;
-            } else {
-                if (yych <= '\'') goto yy1141;
-                if (yych <= '/') goto yy1151;
-                goto yy1152;
-            }
-        } else {
-            if (yych <= 'T') {
-                if (yych == '?') goto yy1153;
-                goto yy1151;
-            } else {
-                if (yych <= 'U') goto yy1154;
-                if (yych == '\\') goto yy1141;
-                goto yy1151;
-            }
-        }
-    } else {
-        if (yych <= 'r') {
-            if (yych <= 'f') {
-                if (yych <= 'b') goto yy1141;
-                if (yych <= 'e') goto yy1151;
-                goto yy1141;
-            } else {
-                if (yych == 'n') goto yy1141;
-                if (yych <= 'q') goto yy1151;
-                goto yy1141;
-            }
-        } else {
-            if (yych <= 'u') {
-                if (yych <= 's') goto yy1151;
-                if (yych <= 't') goto yy1141;
-                goto yy1155;
-            } else {
-                if (yych <= 'v') goto yy1141;
-                if (yych == 'x') goto yy1156;
-                goto yy1151;
-            }
-        }
-    }
-yy1158:
-    yych = *++YYCURSOR;
-    if (yych <= '/') goto yy1142;
-    if (yych <= '7') goto yy1141;
-    goto yy1142;
-yy1159:
-    yych = *++YYCURSOR;
-    if (yych == '/') goto yy1141;
-    goto yy1151;
-yy1160:
-    yych = *++YYCURSOR;
-    if (yych <= '@') {
-        if (yych <= '/') goto yy1151;
-        if (yych <= '9') goto yy1164;
-        goto yy1151;
-    } else {
-        if (yych <= 'F') goto yy1164;
-        if (yych <= '`') goto yy1151;
-        if (yych <= 'f') goto yy1164;
-        goto yy1151;
-    }
-yy1161:
-    yych = *++YYCURSOR;
-    if (yych <= '@') {
-        if (yych <= '/') goto yy1151;
-        if (yych <= '9') goto yy1165;
-        goto yy1151;
-    } else {
-        if (yych <= 'F') goto yy1165;
-        if (yych <= '`') goto yy1151;
-        if (yych <= 'f') goto yy1165;
-        goto yy1151;
-    }
-yy1162:
-    ++YYCURSOR;
-    if (YYLIMIT <= YYCURSOR) YYFILL(1);
-    yych = *YYCURSOR;
-    if (yybm[0+yych] & 128) {
-        goto yy1162;
-    }
-    goto yy1142;
-yy1164:
-    yych = *++YYCURSOR;
-    if (yych <= '@') {
-        if (yych <= '/') goto yy1151;
-        if (yych <= '9') goto yy1166;
-        goto yy1151;
-    } else {
-        if (yych <= 'F') goto yy1166;
-        if (yych <= '`') goto yy1151;
-        if (yych <= 'f') goto yy1166;
-        goto yy1151;
-    }
-yy1165:
-    yych = *++YYCURSOR;
-    if (yych <= '@') {
-        if (yych <= '/') goto yy1151;
-        if (yych <= '9') goto yy1167;
-        goto yy1151;
-    } else {
-        if (yych <= 'F') goto yy1167;
-        if (yych <= '`') goto yy1151;
-        if (yych <= 'f') goto yy1167;
-        goto yy1151;
-    }
-yy1166:
-    yych = *++YYCURSOR;
-    if (yych <= '@') {
-        if (yych <= '/') goto yy1151;
-        if (yych <= '9') goto yy1155;
-        goto yy1151;
-    } else {
-        if (yych <= 'F') goto yy1155;
-        if (yych <= '`') goto yy1151;
-        if (yych <= 'f') goto yy1155;
-        goto yy1151;
-    }
-yy1167:
-    yych = *++YYCURSOR;
-    if (yych <= '@') {
-        if (yych <= '/') goto yy1151;
-        if (yych <= '9') goto yy1141;
-        goto yy1151;
-    } else {
-        if (yych <= 'F') goto yy1141;
-        if (yych <= '`') goto yy1151;
-        if (yych <= 'f') goto yy1141;
-        goto yy1151;
-    }
-}
-#line 610 "strict_cpp.re"
-
+    // we have consumed the double quote but not the lparen, the delimiter
+    // and the body are scanned in place by scan_raw_string()
+    token_id const id = scan_raw_string(s, cursor);
+    set_cursor(limit, s->lim);
+    marker = cursor;
+    WAVE_RET(id);
 }
@@ -0,0 +1,76 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+#include "cpp_lex_token.hpp"
+#include "detect_include_guards.hpp"
+#include "file_position.hpp"
+#include "language_support.hpp"
+
+#include <memory>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    class error_sink;
+    class identifier_interner;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  reusable_lexer
+    //
+    //      A lexer which is reset onto new input instead of being recreated
+    //      for each of them. The scanner buffer, the queue of the line splice
+    //      offsets, and the storage of the file name are kept, thus lexing
+    //      many small inputs doesn't allocate memory for each of them (the
+    //      tokens themselves aside).
+    //
+    //      If lazy token values are enabled by the language options, the
+    //      tokens refer to the input retained by this object, they are valid
+    //      until the next call to reset().
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename IteratorT,
+        typename PositionT = wave::util::file_position_type>
+    class reusable_lexer
+    {
+    public:
+        using token_type = lex_token<PositionT>;
+        using position_type = PositionT;
+
+        reusable_lexer() noexcept;
+        ~reusable_lexer();
+
+        reusable_lexer(reusable_lexer&&) noexcept;
+        reusable_lexer& operator=(reusable_lexer&&) noexcept;
+
+        // start lexing the given input, allocates only on the first call (or
+        // if the input is larger than any of the previous ones)
+        void reset(IteratorT const& first, IteratorT const& last,
+            PositionT const& pos, language_support language);
+
+        // the next token of the input, T_EOF at its end, and an invalid token
+        // (T_EOI) afterwards
+        token_type& get(token_type& result);
+
+        // these settings are kept across calls to reset()
+        void set_error_sink(error_sink* errors) noexcept;
+        void set_include_guards(include_guards<token_type>* guards) noexcept;
+        void set_identifier_interner(identifier_interner* interner) noexcept;
+
+    private:
+        struct data;
+
+        std::unique_ptr<data> impl;
+        error_sink* errors = nullptr;
+        include_guards<token_type>* guards = nullptr;
+        identifier_interner* interner = nullptr;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
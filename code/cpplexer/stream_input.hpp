@@ -0,0 +1,204 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <istream>
+#include <system_error>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  stream_input
+    //
+    //      Abstract source of input characters for the lexer which is read in
+    //      chunks directly into the scanner buffer. The input is consumed
+    //      exactly once, so it does not need to be seekable (pipes, sockets,
+    //      decompressor output, etc.).
+    //
+    //      The scanner needs to look at one character past the end of a chunk
+    //      if the chunk ends with a backslash, and gives a trailing '?' or
+    //      '??' (a possibly split trigraph) back to the input. The push back
+    //      of up to four characters supported by unget()/putback() is
+    //      sufficient for this.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    class stream_input
+    {
+    public:
+        stream_input() = default;
+        virtual ~stream_input() = default;
+
+        stream_input(stream_input const&) = delete;
+        stream_input& operator=(stream_input const&) = delete;
+
+        // read up to 'count' characters, returns less than 'count' only if
+        // the end of the input was reached
+        std::size_t read(char* buffer, std::size_t count)
+        {
+            std::size_t result = 0;
+            while (result != count && pushed != 0)
+                buffer[result++] = pushback[--pushed];
+
+            while (result != count)
+            {
+                std::size_t const cnt =
+                    do_read(buffer + result, count - result);
+                if (cnt == 0)
+                    break;
+                result += cnt;
+            }
+            return result;
+        }
+
+        // read a single character, returns -1 at end of input
+        int get()
+        {
+            if (pushed != 0)
+            {
+                last = static_cast<unsigned char>(pushback[--pushed]);
+                return last;
+            }
+
+            char ch;
+            last = (do_read(&ch, 1) == 1) ? static_cast<unsigned char>(ch) : -1;
+            return last;
+        }
+
+        // push back the character returned by the last call to get()
+        void unget() noexcept
+        {
+            if (last != -1)
+                putback(static_cast<char>(last));
+            last = -1;
+        }
+
+        // push back a character, it is returned before the ones pushed back
+        // earlier and before the remaining input
+        void putback(char ch) noexcept
+        {
+            assert(pushed < sizeof(pushback));
+            pushback[pushed++] = ch;
+        }
+
+    protected:
+        // read at most 'count' characters, return zero at end of input only
+        virtual std::size_t do_read(char* buffer, std::size_t count) = 0;
+
+    private:
+        char pushback[4] = {};
+        std::size_t pushed = 0;
+        int last = -1;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  Read the lexer input from a std::istream
+    class istream_input : public stream_input
+    {
+    public:
+        explicit istream_input(std::istream& strm)
+          : strm(strm)
+        {
+        }
+
+    protected:
+        std::size_t do_read(char* buffer, std::size_t count) override
+        {
+            strm.read(buffer, static_cast<std::streamsize>(count));
+            return static_cast<std::size_t>(strm.gcount());
+        }
+
+    private:
+        std::istream& strm;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  Read the lexer input from a (possibly non-seekable) file descriptor
+    class fd_input : public stream_input
+    {
+    public:
+        explicit fd_input(int fd) noexcept
+          : fd(fd)
+        {
+        }
+
+    protected:
+        std::size_t do_read(char* buffer, std::size_t count) override
+        {
+            while (true)
+            {
+#if defined(_WIN32)
+                auto const cnt = ::_read(fd, buffer,
+                    static_cast<unsigned int>(
+                        count > 0x40000000 ? 0x40000000 : count));
+#else
+                auto const cnt = ::read(fd, buffer, count);
+#endif
+                if (cnt >= 0)
+                    return static_cast<std::size_t>(cnt);
+
+                if (errno != EINTR)
+                {
+                    throw std::system_error(errno, std::generic_category(),
+                        "Could not read from input");
+                }
+            }
+        }
+
+    private:
+        int fd;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  stream_input_ref
+    //
+    //      The lexer is parameterized with the type of the iterators it reads
+    //      its input from. Using this type instead of a real iterator type
+    //      selects the chunked reading code path of the scanner (see
+    //      re2clex/cpp_re.hpp). A default constructed instance denotes the end
+    //      of the input.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    class stream_input_ref
+    {
+    public:
+        stream_input_ref() = default;
+        explicit stream_input_ref(stream_input& input) noexcept
+          : input(&input)
+        {
+        }
+
+        stream_input* operator->() const noexcept
+        {
+            return input;
+        }
+
+        friend bool operator==(
+            stream_input_ref const& lhs, stream_input_ref const& rhs) noexcept
+        {
+            return lhs.input == rhs.input;
+        }
+
+    private:
+        stream_input* input = nullptr;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
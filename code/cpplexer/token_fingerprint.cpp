@@ -0,0 +1,280 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "token_fingerprint.hpp"
+#include "token_soa_buffer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    namespace {
+
+        constexpr std::uint64_t c1 = 0x87c37b91114253d5ULL;
+        constexpr std::uint64_t c2 = 0x4cf5ad432745937fULL;
+
+        constexpr std::uint64_t rotl64(std::uint64_t x, int r) noexcept
+        {
+            return (x << r) | (x >> (64 - r));
+        }
+
+        constexpr std::uint64_t fmix64(std::uint64_t k) noexcept
+        {
+            k ^= k >> 33;
+            k *= 0xff51afd7ed558ccdULL;
+            k ^= k >> 33;
+            k *= 0xc4ceb9fe1a85ec53ULL;
+            k ^= k >> 33;
+            return k;
+        }
+
+        std::uint64_t load64(unsigned char const* p) noexcept
+        {
+            std::uint64_t result;
+            std::memcpy(&result, p, sizeof(result));
+            return result;
+        }
+
+        // add a single token to the given hash
+        void hash_token(
+            hash128& hash, token_id id, std::string_view value) noexcept
+        {
+            std::uint32_t const header[2] = {static_cast<std::uint32_t>(id),
+                static_cast<std::uint32_t>(value.size())};
+            hash.update(header, sizeof(header));
+            hash.update(value.data(), value.size());
+        }
+
+        // return the significant part of the value of a preprocessor
+        // directive token
+        std::string_view directive_value(
+            token_id id, std::string_view value) noexcept
+        {
+            token_id const base = static_cast<token_id>(id & ~AltTokenType);
+            if (T_PP_HHEADER != base && T_PP_QHEADER != base &&
+                T_PP_INCLUDE != base)
+            {
+                return {};
+            }
+
+            std::size_t const name = value.find_first_of("<\"");
+            return name == std::string_view::npos ? std::string_view() :
+                                                    value.substr(name);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void hash128::block(unsigned char const* data) noexcept
+    {
+        std::uint64_t k1 = load64(data);
+        std::uint64_t k2 = load64(data + 8);
+
+        k1 *= c1;
+        k1 = rotl64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+
+        h1 = rotl64(h1, 27);
+        h1 += h2;
+        h1 = h1 * 5 + 0x52dce729;
+
+        k2 *= c2;
+        k2 = rotl64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+
+        h2 = rotl64(h2, 31);
+        h2 += h1;
+        h2 = h2 * 5 + 0x38495ab5;
+    }
+
+    void hash128::update(void const* data, std::size_t size) noexcept
+    {
+        auto const* p = static_cast<unsigned char const*>(data);
+        length += size;
+
+        // complete a partial block left over from the previous call
+        if (tail_size != 0)
+        {
+            std::size_t const count =
+                size < 16 - tail_size ? size : 16 - tail_size;
+            std::memcpy(tail + tail_size, p, count);
+            tail_size += count;
+            p += count;
+            size -= count;
+
+            if (tail_size != 16)
+                return;
+
+            block(tail);
+            tail_size = 0;
+        }
+
+        for (/**/; size >= 16; size -= 16, p += 16)
+            block(p);
+
+        if (size != 0)
+        {
+            std::memcpy(tail, p, size);
+            tail_size = size;
+        }
+    }
+
+    token_fingerprint hash128::finalize() const noexcept
+    {
+        std::uint64_t r1 = h1;
+        std::uint64_t r2 = h2;
+
+        std::uint64_t k1 = 0;
+        std::uint64_t k2 = 0;
+        for (std::size_t i = tail_size; i > 8; --i)
+            k2 |= std::uint64_t(tail[i - 1]) << ((i - 9) * 8);
+        for (std::size_t i = tail_size < 8 ? tail_size : 8; i > 0; --i)
+            k1 |= std::uint64_t(tail[i - 1]) << ((i - 1) * 8);
+
+        if (tail_size > 8)
+        {
+            k2 *= c2;
+            k2 = rotl64(k2, 33);
+            k2 *= c1;
+            r2 ^= k2;
+        }
+        if (tail_size != 0)
+        {
+            k1 *= c1;
+            k1 = rotl64(k1, 31);
+            k1 *= c2;
+            r1 ^= k1;
+        }
+
+        r1 ^= length;
+        r2 ^= length;
+
+        r1 += r2;
+        r2 += r1;
+
+        r1 = fmix64(r1);
+        r2 = fmix64(r2);
+
+        r1 += r2;
+        r2 += r1;
+
+        return token_fingerprint{r1, r2};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void fingerprint_builder::end_declaration()
+    {
+        if (in_declaration)
+        {
+            declarations->push_back(declaration_fingerprint{
+                declaration.finalize(), first_line, last_line});
+            declaration = hash128();
+            in_declaration = false;
+        }
+    }
+
+    void fingerprint_builder::add(token_id id, std::string_view value,
+        std::size_t token_first_line, std::size_t token_last_line)
+    {
+        if (IS_CATEGORY(id, EOLTokenType))
+        {
+            if (in_directive)
+            {
+                in_directive = false;
+                end_declaration();
+            }
+            return;
+        }
+        if (IS_CATEGORY(id, WhiteSpaceTokenType))
+            return;
+
+        bool const is_directive = IS_CATEGORY(id, PPTokenType);
+        if (is_directive)
+            value = directive_value(id, value);
+
+        hash_token(hash, id, value);
+
+        if (declarations == nullptr)
+            return;
+
+        if (is_directive && depth == 0 && !in_directive)
+        {
+            end_declaration();
+            in_directive = true;
+            after_closing_brace = false;
+        }
+        else if (after_closing_brace)
+        {
+            after_closing_brace = false;
+            if (T_SEMICOLON != BASE_TOKEN(id))
+                end_declaration();
+        }
+
+        if (!in_declaration)
+        {
+            in_declaration = true;
+            first_line = token_first_line;
+        }
+        hash_token(declaration, id, value);
+        last_line = token_last_line;
+
+        if (in_directive)
+            return;
+
+        token_id const base = BASE_TOKEN(id);
+        if (T_LEFTBRACE == base)
+        {
+            ++depth;
+        }
+        else if (T_RIGHTBRACE == base)
+        {
+            if (depth != 0 && --depth == 0)
+                after_closing_brace = true;
+        }
+        else if (T_SEMICOLON == base && depth == 0)
+        {
+            end_declaration();
+        }
+    }
+
+    token_fingerprint fingerprint_builder::finalize()
+    {
+        if (declarations != nullptr)
+            end_declaration();
+        return hash.finalize();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    token_fingerprint fingerprint(token_soa_buffer const& tokens,
+        std::vector<declaration_fingerprint>* declarations)
+    {
+        fingerprint_builder builder(declarations);
+
+        auto const ids = tokens.ids();
+        auto const offsets = tokens.offsets();
+        auto const lengths = tokens.lengths();
+        auto const lines = tokens.lines();
+        line_index const& line_table = tokens.line_table();
+
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            // the last line is needed for the declarations only, a token
+            // spans lines only if it contains a newline (or a line splice)
+            std::size_t last_line = lines[i];
+            if (declarations != nullptr && lengths[i] > 1)
+                last_line = line_table.line(offsets[i] + lengths[i] - 1);
+
+            builder.add(ids[i], tokens.value(i), lines[i], last_line);
+        }
+        return builder.finalize();
+    }
+}    // namespace wave::cpplexer
@@ -0,0 +1,166 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+#include "file_position.hpp"
+#include "language_support.hpp"
+#include "token_ids.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  128 bit hash value of a token sequence
+    struct token_fingerprint
+    {
+        std::uint64_t low = 0;
+        std::uint64_t high = 0;
+
+        friend bool operator==(
+            token_fingerprint const&, token_fingerprint const&) = default;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  hash value of a top level declaration (or preprocessor directive)
+    struct declaration_fingerprint
+    {
+        token_fingerprint fingerprint;
+        std::size_t first_line;
+        std::size_t last_line;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  hash128
+    //
+    //      Streaming version of the 128 bit (x64) variant of MurmurHash3, the
+    //      result does not depend on how the input is split into update()
+    //      calls.
+    //
+    //      Known answers of the reference implementation (seed 0, as low,
+    //      high):
+    //          ""      -> 0x0000000000000000, 0x0000000000000000
+    //          "hello" -> 0xcbd8a7b341bd9b02, 0x5b1e906a48ae1d19
+    //          "The quick brown fox jumps over the lazy dog"
+    //                  -> 0xe34bbc7bbc071b6c, 0x7a433ca9c49a9347
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    class hash128
+    {
+    public:
+        explicit hash128(std::uint64_t seed = 0) noexcept
+          : h1(seed)
+          , h2(seed)
+        {
+        }
+
+        void update(void const* data, std::size_t size) noexcept;
+
+        token_fingerprint finalize() const noexcept;
+
+    private:
+        void block(unsigned char const* data) noexcept;
+
+        std::uint64_t h1;
+        std::uint64_t h2;
+        std::uint64_t length = 0;
+        unsigned char tail[16] = {};
+        std::size_t tail_size = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  fingerprint_builder
+    //
+    //      Compute the fingerprint of a token sequence given one token at a
+    //      time (see token_fingerprint_gen for the tokens which are
+    //      significant and for how the top level declarations are split).
+    //      'first_line' and 'last_line' are the lines of the first and of
+    //      the last character of the token.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    class fingerprint_builder
+    {
+    public:
+        explicit fingerprint_builder(
+            std::vector<declaration_fingerprint>* declarations_ =
+                nullptr) noexcept
+          : declarations(declarations_)
+        {
+        }
+
+        void add(token_id id, std::string_view value, std::size_t first_line,
+            std::size_t last_line);
+
+        // the fingerprint of all tokens, completes the last declaration
+        token_fingerprint finalize();
+
+    private:
+        void end_declaration();
+
+        std::vector<declaration_fingerprint>* declarations;
+        hash128 hash;
+
+        // the state of the current top level declaration
+        hash128 declaration;
+        std::size_t first_line = 0;
+        std::size_t last_line = 0;
+        std::size_t depth = 0;
+        bool in_declaration = false;
+        bool in_directive = false;
+        bool after_closing_brace = false;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  token_fingerprint_gen
+    //
+    //      Compute the fingerprint of the significant tokens of the given
+    //      input: white space, newlines and comments are ignored, all other
+    //      tokens contribute their id and their spelling. Preprocessor
+    //      directive tokens contribute their id only (and the header name for
+    //      #include directives), i.e. the white space inside of '#  define' is
+    //      not significant either.
+    //
+    //      The tokens are produced by the scanner directly, no token objects
+    //      are created and no token values are copied. The identifiers and
+    //      literals are not validated.
+    //
+    //      If 'declarations' is given, one fingerprint per top level
+    //      declaration is appended. A top level declaration ends with a ';'
+    //      or a '}' at brace depth zero (a ';' directly following such a '}'
+    //      still belongs to the declaration). Every preprocessor directive
+    //      outside of braces is reported as a declaration of its own.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename IteratorT,
+        typename PositionT = wave::util::file_position_type>
+    struct token_fingerprint_gen
+    {
+        static token_fingerprint fingerprint(IteratorT const& first,
+            IteratorT const& last, PositionT const& pos,
+            language_support language,
+            std::vector<declaration_fingerprint>* declarations = nullptr);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  Compute the fingerprint of the tokens stored in a token_soa_buffer
+    //  (e.g. in directory_sink::consume), the result is the same as the one
+    //  of token_fingerprint_gen for the lexed input.
+    class token_soa_buffer;
+
+    token_fingerprint fingerprint(token_soa_buffer const& tokens,
+        std::vector<declaration_fingerprint>* declarations = nullptr);
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
@@ -0,0 +1,232 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+#include "cpp_lex_token.hpp"
+#include "error_sink.hpp"
+#include "file_position.hpp"
+#include "language_support.hpp"
+#include "token_value_buffer.hpp"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  generator
+    //
+    //      The result of a coroutine yielding lvalues of type T (a subset of
+    //      C++23 std::generator). The coroutine runs only while the next
+    //      element is requested, either by next() or by incrementing the
+    //      iterator. The yielded element is valid until the coroutine is
+    //      resumed. An exception thrown by the coroutine is rethrown from
+    //      the call which resumed it, the generator is finished afterwards.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class generator
+    {
+    public:
+        class promise_type;
+        class iterator;
+
+        using handle_type = std::coroutine_handle<promise_type>;
+
+        generator(generator&& rhs) noexcept
+          : coro(std::exchange(rhs.coro, nullptr))
+        {
+        }
+        generator& operator=(generator&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                if (coro)
+                    coro.destroy();
+                coro = std::exchange(rhs.coro, nullptr);
+            }
+            return *this;
+        }
+
+        ~generator()
+        {
+            if (coro)
+                coro.destroy();
+        }
+
+        // resume the coroutine, returns the next element or nullptr if the
+        // coroutine has finished
+        T* next();
+
+        // begin() resumes the coroutine for the first element
+        iterator begin();
+        [[nodiscard]] std::default_sentinel_t end() const noexcept
+        {
+            return {};
+        }
+
+    private:
+        explicit generator(handle_type coro_) noexcept
+          : coro(coro_)
+        {
+        }
+
+        handle_type coro;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class generator<T>::promise_type
+    {
+    public:
+        generator get_return_object() noexcept
+        {
+            return generator(handle_type::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+        std::suspend_always final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always yield_value(T& value) noexcept
+        {
+            current = std::addressof(value);
+            return {};
+        }
+
+        // the coroutine is driven by its consumer, it can't await anything
+        template <typename U>
+        std::suspend_never await_transform(U&&) = delete;
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() noexcept
+        {
+            error = std::current_exception();
+        }
+
+    private:
+        friend class generator;
+
+        T* current = nullptr;
+        std::exception_ptr error;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  input iterator over the elements of a generator
+    template <typename T>
+    class generator<T>::iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+
+        iterator() = default;
+
+        T& operator*() const noexcept
+        {
+            return *current;
+        }
+        T* operator->() const noexcept
+        {
+            return current;
+        }
+
+        iterator& operator++()
+        {
+            current = owner->next();
+            return *this;
+        }
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        friend bool operator==(
+            iterator const& it, std::default_sentinel_t) noexcept
+        {
+            return it.current == nullptr;
+        }
+
+    private:
+        friend class generator;
+
+        iterator(generator* owner_, T* current_) noexcept
+          : owner(owner_)
+          , current(current_)
+        {
+        }
+
+        generator* owner = nullptr;
+        T* current = nullptr;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    T* generator<T>::next()
+    {
+        if (!coro || coro.done())
+            return nullptr;
+
+        promise_type& promise = coro.promise();
+        promise.current = nullptr;
+        coro.resume();
+        if (promise.error)
+            std::rethrow_exception(std::exchange(promise.error, nullptr));
+
+        return coro.done() ? nullptr : promise.current;
+    }
+
+    template <typename T>
+    typename generator<T>::iterator generator<T>::begin()
+    {
+        return iterator(this, next());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  generate_tokens
+    //
+    //      Lex the given input in a coroutine, yielding the tokens up to and
+    //      including the final T_EOF token. The lexer state lives in the
+    //      coroutine frame, thus any number of inputs can be lexed
+    //      alternately on a single thread (e.g. to merge the token streams
+    //      of several files) without using a lex_iterator.
+    //
+    //      The arguments are copied into the coroutine frame, the input they
+    //      refer to has to outlive the generator. The lexer errors are thrown
+    //      (from the call resuming the generator) or reported to the given
+    //      error sink. If lazy token values are enabled by the language
+    //      options, the token values refer to the given buffer (which has to
+    //      outlive the tokens), otherwise they are copied.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename IteratorT,
+        typename PositionT = wave::util::file_position_type,
+        typename TokenT = lex_token<PositionT>>
+    generator<TokenT> generate_tokens(IteratorT first, IteratorT last,
+        PositionT pos, language_support language,
+        error_sink* errors = nullptr, token_value_buffer* values = nullptr);
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
+
+#include "re2clex/cpp_re2c_generator.hpp"
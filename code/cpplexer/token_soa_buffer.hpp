@@ -0,0 +1,310 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "config.hpp"
+#include "error_sink.hpp"
+#include "file_position.hpp"
+#include "language_support.hpp"
+#include "line_index.hpp"
+#include "token_ids.hpp"
+#include "token_value_buffer.hpp"
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  a single token stored in a token_soa_buffer
+    struct token_view
+    {
+        token_id id;
+        std::string_view value;
+        std::uint32_t line;
+        std::uint16_t column;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  token_soa_buffer
+    //
+    //      The tokens of a file stored as parallel arrays (one element per
+    //      token in each of them), the values of the tokens refer to the
+    //      (line splice free) input retained by this object. This allows to
+    //      run filters over the token ids (or any other property) without
+    //      touching the rest of the token data.
+    //
+    //      The value of a token is its spelling in the input, i.e. trigraphs
+    //      are not converted and the values of identifiers and literals are
+    //      not validated. Columns beyond 65535 are stored as 65535.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    class token_soa_buffer
+    {
+    public:
+        class iterator;
+
+        token_soa_buffer()
+          : text(std::make_unique<token_value_buffer>())
+        {
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return token_ids.size();
+        }
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return token_ids.empty();
+        }
+
+        [[nodiscard]] std::span<token_id const> ids() const noexcept
+        {
+            return token_ids;
+        }
+        [[nodiscard]] std::span<std::uint32_t const> offsets() const noexcept
+        {
+            return token_offsets;
+        }
+        [[nodiscard]] std::span<std::uint32_t const> lengths() const noexcept
+        {
+            return token_lengths;
+        }
+        [[nodiscard]] std::span<std::uint32_t const> lines() const noexcept
+        {
+            return token_lines;
+        }
+        [[nodiscard]] std::span<std::uint16_t const> columns() const noexcept
+        {
+            return token_columns;
+        }
+
+        [[nodiscard]] std::string_view value(std::size_t i) const noexcept
+        {
+            return {text->get(token_offsets[i]), token_lengths[i]};
+        }
+
+        [[nodiscard]] token_view operator[](std::size_t i) const noexcept
+        {
+            return token_view{
+                token_ids[i], value(i), token_lines[i], token_columns[i]};
+        }
+
+        [[nodiscard]] iterator begin() const noexcept;
+        [[nodiscard]] iterator end() const noexcept;
+
+        // remove all tokens and release the retained input
+        void clear() noexcept
+        {
+            token_ids.clear();
+            token_offsets.clear();
+            token_lengths.clear();
+            token_lines.clear();
+            token_columns.clear();
+            line_starts.clear();
+            text->reset();
+        }
+
+        void reserve(std::size_t count)
+        {
+            token_ids.reserve(count);
+            token_offsets.reserve(count);
+            token_lengths.reserve(count);
+            token_lines.reserve(count);
+            token_columns.reserve(count);
+        }
+
+        // the start offsets of the lines of the input
+        [[nodiscard]] line_index const& line_table() const noexcept
+        {
+            return line_starts;
+        }
+        [[nodiscard]] line_index& line_table() noexcept
+        {
+            return line_starts;
+        }
+
+        // the buffer the lexer retains its input in, the offsets of the
+        // tokens refer to it
+        [[nodiscard]] token_value_buffer& input_buffer() noexcept
+        {
+            return *text;
+        }
+
+        void push_back(token_id id, std::size_t offset, std::size_t length,
+            std::size_t line, std::size_t column);
+
+    private:
+        std::vector<token_id> token_ids;
+        std::vector<std::uint32_t> token_offsets;
+        std::vector<std::uint32_t> token_lengths;
+        std::vector<std::uint32_t> token_lines;
+        std::vector<std::uint16_t> token_columns;
+        line_index line_starts;
+        std::unique_ptr<token_value_buffer> text;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  random access iterator returning the tokens as token_view objects
+    class token_soa_buffer::iterator
+    {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = token_view;
+        using difference_type = std::ptrdiff_t;
+        using reference = token_view;
+
+        iterator() = default;
+        iterator(token_soa_buffer const* buffer_, std::size_t index_) noexcept
+          : buffer(buffer_)
+          , index(static_cast<difference_type>(index_))
+        {
+        }
+
+        token_view operator*() const noexcept
+        {
+            return (*buffer)[index];
+        }
+        token_view operator[](difference_type n) const noexcept
+        {
+            return (*buffer)[index + n];
+        }
+
+        iterator& operator++() noexcept
+        {
+            ++index;
+            return *this;
+        }
+        iterator operator++(int) noexcept
+        {
+            iterator tmp = *this;
+            ++index;
+            return tmp;
+        }
+        iterator& operator--() noexcept
+        {
+            --index;
+            return *this;
+        }
+        iterator operator--(int) noexcept
+        {
+            iterator tmp = *this;
+            --index;
+            return tmp;
+        }
+
+        iterator& operator+=(difference_type n) noexcept
+        {
+            index += n;
+            return *this;
+        }
+        iterator& operator-=(difference_type n) noexcept
+        {
+            index -= n;
+            return *this;
+        }
+
+        friend iterator operator+(iterator it, difference_type n) noexcept
+        {
+            return it += n;
+        }
+        friend iterator operator+(difference_type n, iterator it) noexcept
+        {
+            return it += n;
+        }
+        friend iterator operator-(iterator it, difference_type n) noexcept
+        {
+            return it -= n;
+        }
+        friend difference_type operator-(
+            iterator const& lhs, iterator const& rhs) noexcept
+        {
+            return lhs.index - rhs.index;
+        }
+
+        friend bool operator==(
+            iterator const& lhs, iterator const& rhs) noexcept
+        {
+            return lhs.index == rhs.index;
+        }
+        friend std::strong_ordering operator<=>(
+            iterator const& lhs, iterator const& rhs) noexcept
+        {
+            return lhs.index <=> rhs.index;
+        }
+
+    private:
+        token_soa_buffer const* buffer = nullptr;
+        difference_type index = 0;
+    };
+
+    inline token_soa_buffer::iterator token_soa_buffer::begin() const noexcept
+    {
+        return {this, 0};
+    }
+
+    inline token_soa_buffer::iterator token_soa_buffer::end() const noexcept
+    {
+        return {this, size()};
+    }
+
+    inline void token_soa_buffer::push_back(token_id id, std::size_t offset,
+        std::size_t length, std::size_t line, std::size_t column)
+    {
+        constexpr std::size_t max_offset =
+            (std::numeric_limits<std::uint32_t>::max)();
+        constexpr std::size_t max_column =
+            (std::numeric_limits<std::uint16_t>::max)();
+
+        if (offset + length > max_offset)
+        {
+            throw std::length_error("token_soa_buffer: input exceeds 4GB");
+        }
+
+        token_ids.push_back(id);
+        token_offsets.push_back(static_cast<std::uint32_t>(offset));
+        token_lengths.push_back(static_cast<std::uint32_t>(length));
+        token_lines.push_back(static_cast<std::uint32_t>(line));
+        token_columns.push_back(static_cast<std::uint16_t>(
+            column < max_column ? column : max_column));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  token_soa_gen
+    //
+    //      Lex the given input into a token_soa_buffer (the previous content
+    //      of which is discarded). The tokens are produced by the scanner
+    //      directly, no token objects are created and no token values are
+    //      copied. The final T_EOF token is not stored.
+    //
+    //      The lexer errors are thrown as a lexing_exception or reported to
+    //      the given error sink.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename IteratorT,
+        typename PositionT = wave::util::file_position_type>
+    struct token_soa_gen
+    {
+        static void lex(IteratorT const& first, IteratorT const& last,
+            PositionT const& pos, language_support language,
+            token_soa_buffer& result, error_sink* errors = nullptr);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
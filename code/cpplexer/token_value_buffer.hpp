@@ -0,0 +1,80 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "buffer_pool.hpp"
+#include "config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace wave::cpplexer {
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //
+    //  token_value_buffer
+    //
+    //      Holds the complete (line splice free) input of a lexer, if lazy
+    //      token values are enabled (see support_option_lazy_token_values).
+    //      The tokens returned by such a lexer refer to this buffer instead
+    //      of holding a copy of their text, thus the buffer has to outlive
+    //      all of these tokens.
+    //
+    //      The memory is (re-)allocated by the scanner while it reads the
+    //      input, it is owned by this object and is returned to the scanner
+    //      buffer pool once released. The values of the tokens referring to
+    //      it are materialized holding value_mutex, thus copies of a token
+    //      can be used by different threads.
+    //
+    ///////////////////////////////////////////////////////////////////////////////
+    class token_value_buffer
+    {
+    public:
+        token_value_buffer() = default;
+
+        token_value_buffer(token_value_buffer const&) = delete;
+        token_value_buffer& operator=(token_value_buffer const&) = delete;
+
+        ~token_value_buffer()
+        {
+            detail::release_scanner_buffer(data, capacity);
+        }
+
+        // release the buffer, invalidates all tokens referring to it
+        void reset() noexcept
+        {
+            detail::release_scanner_buffer(data, capacity);
+            data = nullptr;
+            capacity = 0;
+        }
+
+        [[nodiscard]] char const* get(std::size_t offset) const noexcept
+        {
+            return reinterpret_cast<char const*>(data) + offset;
+        }
+
+        unsigned char* data = nullptr;
+        std::size_t capacity = 0;
+
+        mutable std::mutex value_mutex;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    //  the not yet materialized value of a token, values needing trigraph
+    //  conversion and values beyond the first 4GB of the input are always
+    //  materialized by the lexer
+    struct token_value_ref
+    {
+        token_value_buffer const* buffer = nullptr;
+        std::uint32_t offset = 0;
+        std::uint32_t length = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+}    // namespace wave::cpplexer
@@ -12,8 +12,10 @@
 #pragma once
 
 #include <cassert>
+#include <string_view>
 
 #include "cpplexer_exceptions.hpp"
+#include "error_sink.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace wave::cpplexer::impl {
@@ -204,12 +206,14 @@ namespace wave::cpplexer::impl {
     //      classify_universal_char above).
     //
     //      If the identifier name contains invalid or not allowed universal
-    //      characters a corresponding lexing_exception is thrown.
+    //      characters a corresponding lexing_exception is thrown (or reported
+    //      to the given error sink).
     //
     ///////////////////////////////////////////////////////////////////////////////
     template <typename StringT>
     void validate_identifier_name(StringT const& name, std::size_t line,
-        std::size_t column, StringT const& file_name)
+        std::size_t column, StringT const& file_name,
+        error_sink* errors = nullptr)
     {
         using namespace std;    // some systems have strtoul in namespace std::
 
@@ -227,26 +231,28 @@ namespace wave::cpplexer::impl {
 
             if (universal_char_type_valid != type)
             {
-                // an invalid char was found, so throw an exception
-                StringT error_uchar(
-                    name.substr(pos, ('u' == name[pos + 1]) ? 6 : 10));
+                // an invalid char was found, so report an error
+                std::string_view const error_uchar =
+                    std::string_view(name.data(), name.size())
+                        .substr(pos, ('u' == name[pos + 1]) ? 6 : 10);
 
                 if (universal_char_type_invalid == type)
                 {
-                    WAVE_LEXER_THROW(lexing_exception, universal_char_invalid,
-                        error_uchar, line, column, file_name.c_str())
+                    report_lexing_error(errors,
+                        lexing_exception::universal_char_invalid, error_uchar,
+                        line, column, file_name.c_str());
                 }
                 else if (universal_char_type_base_charset == type)
                 {
-                    WAVE_LEXER_THROW(lexing_exception,
-                        universal_char_base_charset, error_uchar, line, column,
-                        file_name.c_str())
+                    report_lexing_error(errors,
+                        lexing_exception::universal_char_base_charset,
+                        error_uchar, line, column, file_name.c_str());
                 }
                 else
                 {
-                    WAVE_LEXER_THROW(lexing_exception,
-                        universal_char_not_allowed, error_uchar, line, column,
-                        file_name.c_str())
+                    report_lexing_error(errors,
+                        lexing_exception::universal_char_not_allowed,
+                        error_uchar, line, column, file_name.c_str());
                 }
             }
 
@@ -265,12 +271,14 @@ namespace wave::cpplexer::impl {
     //      classify_universal_char above).
     //
     //      If the string or character literal contains invalid or not allowed
-    //      universal characters a corresponding lexing_exception is thrown.
+    //      universal characters a corresponding lexing_exception is thrown (or
+    //      reported to the given error sink).
     //
     ///////////////////////////////////////////////////////////////////////////////
     template <typename StringT>
     void validate_literal(StringT const& name, std::size_t line,
-        std::size_t column, StringT const& file_name)
+        std::size_t column, StringT const& file_name,
+        error_sink* errors = nullptr)
     {
         using namespace std;    // some systems have strtoul in namespace std::
 
@@ -289,21 +297,22 @@ namespace wave::cpplexer::impl {
                 if (universal_char_type_valid != type &&
                     universal_char_type_not_allowed_for_identifiers != type)
                 {
-                    // an invalid char was found, so throw an exception
-                    StringT error_uchar(
-                        name.substr(pos, ('u' == name[pos + 1]) ? 6 : 10));
+                    // an invalid char was found, so report an error
+                    std::string_view const error_uchar =
+                        std::string_view(name.data(), name.size())
+                            .substr(pos, ('u' == name[pos + 1]) ? 6 : 10);
 
                     if (universal_char_type_invalid == type)
                     {
-                        WAVE_LEXER_THROW(lexing_exception,
-                            universal_char_invalid, error_uchar, line, column,
-                            file_name.c_str())
+                        report_lexing_error(errors,
+                            lexing_exception::universal_char_invalid,
+                            error_uchar, line, column, file_name.c_str());
                     }
                     else
                     {
-                        WAVE_LEXER_THROW(lexing_exception,
-                            universal_char_base_charset, error_uchar, line,
-                            column, file_name.c_str())
+                        report_lexing_error(errors,
+                            lexing_exception::universal_char_base_charset,
+                            error_uchar, line, column, file_name.c_str());
                     }
                 }
             }
@@ -0,0 +1,67 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpplexer.hpp>
+
+#include "test.hpp"
+
+#include <string_view>
+#include <vector>
+
+using wave::cpplexer::dependency_directive;
+using wave::cpplexer::scan_dependencies;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<dependency_directive> scan(std::string_view input)
+{
+    std::vector<dependency_directive> result;
+    scan_dependencies(input, result);
+    return result;
+}
+
+void check_directive(std::string_view input, wave::token_id id,
+    std::string_view value, std::size_t line, std::size_t column)
+{
+    auto const directives = scan(input);
+    CPPLEXER_TEST_EQ(directives.size(), 1u);
+    if (directives.size() != 1)
+        return;
+
+    CPPLEXER_TEST_EQ(directives[0].id, id);
+    CPPLEXER_TEST_EQ(directives[0].value, value);
+    CPPLEXER_TEST_EQ(directives[0].line, line);
+    CPPLEXER_TEST_EQ(directives[0].column, column);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    check_directive("#include <x>\n", wave::T_PP_HHEADER, "<x>", 1, 1);
+    check_directive(
+        "int i;\n  #  include \"x\"\n", wave::T_PP_QHEADER, "\"x\"", 2, 3);
+    check_directive("import <x>;\n", wave::T_IMPORT, "<x>", 1, 1);
+
+    // the position of a directive is the one of the '#', even if a line
+    // splice or a comment spanning lines precedes the directive name
+    check_directive("#\\\n include <x>\n", wave::T_PP_HHEADER, "<x>", 1, 1);
+    check_directive(
+        "\n  # /*\n */ include <x>\n", wave::T_PP_HHEADER, "<x>", 2, 3);
+    check_directive(
+        "export /*\n*/ import <x>;\n", wave::T_IMPORT, "<x>", 1, 1);
+    check_directive(
+        "#\\\r\ninclude <x>\r\n", wave::T_PP_HHEADER, "<x>", 1, 1);
+
+    // directives following such a directive are reported at their own line
+    auto const directives = scan("#\\\ninclude <x>\n#include <y>\n");
+    CPPLEXER_TEST_EQ(directives.size(), 2u);
+    if (directives.size() == 2)
+    {
+        CPPLEXER_TEST_EQ(directives[1].line, 3u);
+        CPPLEXER_TEST_EQ(directives[1].column, 1u);
+    }
+
+    return test::report_errors();
+}
@@ -0,0 +1,95 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpplexer.hpp>
+
+#include "test.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace fs = std::filesystem;
+
+///////////////////////////////////////////////////////////////////////////////
+//  a sink rejecting the files whose name starts with "reject"
+struct rejecting_sink : cpplexer::directory_sink
+{
+    void consume(std::size_t, fs::path const& file,
+        cpplexer::token_soa_buffer const& tokens) override
+    {
+        if (file.filename().string().starts_with("reject"))
+            throw std::runtime_error("rejected: " + file.string());
+        tokens_consumed += tokens.size();
+    }
+
+    void failed(std::size_t, fs::path const&, std::exception_ptr) override
+    {
+        ++failures;
+    }
+
+    std::atomic<std::size_t> tokens_consumed{0};
+    std::atomic<std::size_t> failures{0};
+};
+
+void write_file(fs::path const& path, std::string_view contents)
+{
+    std::ofstream out(path, std::ios::binary);
+    out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+// only the files passed to the sink successfully are counted as consumed
+void test_stats(fs::path const& directory, std::size_t consumed_bytes,
+    bool pipelined)
+{
+    rejecting_sink sink;
+    cpplexer::directory_lexer_options options;
+    options.threads = 2;
+    options.pipelined = pipelined;
+
+    auto const stats = cpplexer::tokenize_directory(directory, sink, options);
+    CPPLEXER_TEST_EQ(stats.files, 5u);
+    CPPLEXER_TEST_EQ(stats.failed_files, 3u);
+    CPPLEXER_TEST_EQ(sink.failures.load(), 3u);
+    CPPLEXER_TEST_EQ(stats.bytes, consumed_bytes);
+    CPPLEXER_TEST_EQ(stats.tokens, sink.tokens_consumed.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    fs::path const directory =
+        fs::temp_directory_path() / "cpplexer_test_directory_lexer";
+    fs::remove_all(directory);
+    fs::create_directories(directory);
+
+    std::string_view const accepted[] = {
+        "int i = 1;\n", "struct a\n{\n    int j;\n};\n"};
+    std::size_t consumed_bytes = 0;
+    for (std::size_t i = 0; i != std::size(accepted); ++i)
+    {
+        write_file(directory / ("accept" + std::to_string(i) + ".cpp"),
+            accepted[i]);
+        consumed_bytes += accepted[i].size();
+    }
+    write_file(directory / "reject0.cpp", "int k = 2;\n");
+    write_file(directory / "reject1.cpp", "long l = 3;\n");
+    write_file(directory / "unterminated.cpp", "int m; /* comment");
+
+    test_stats(directory, consumed_bytes, false);
+    test_stats(directory, consumed_bytes, true);
+
+    std::error_code ec;
+    fs::remove_all(directory, ec);
+
+    return test::report_errors();
+}
@@ -0,0 +1,133 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpplexer.hpp>
+
+#include "test.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<cpplexer::token_type> lex(
+    std::string const& file, cpplexer::token_values values)
+{
+    std::vector<cpplexer::token_type> tokens;
+    auto range = cpplexer::tokenize(file, values);
+    for (auto const& token : range)
+        tokens.push_back(token);
+    return tokens;
+}
+
+// the values of the tokens of a file are the same, independently of how
+// they are held
+void test_values(std::string const& file)
+{
+    auto const owned = lex(file, cpplexer::token_values::owned);
+
+    // the tokens own their values, they are valid after the range was
+    // destroyed
+    std::vector<std::string> values;
+    {
+        auto range = cpplexer::tokenize(file);
+        for (auto const& token : range)
+            values.push_back(token.get_value());
+    }
+    CPPLEXER_TEST_EQ(owned.size(), values.size());
+    for (std::size_t i = 0; i != owned.size() && i != values.size(); ++i)
+        CPPLEXER_TEST_EQ(owned[i].get_value(), values[i]);
+
+    // lazy values are materialized on first access
+    std::vector<cpplexer::token_type> lazy;
+    auto range = cpplexer::tokenize(file, cpplexer::token_values::lazy);
+    for (auto const& token : range)
+        lazy.push_back(token);
+
+    CPPLEXER_TEST_EQ(lazy.size(), owned.size());
+    for (std::size_t i = 0; i != lazy.size() && i != owned.size(); ++i)
+    {
+        CPPLEXER_TEST(lazy[i] == owned[i]);
+        CPPLEXER_TEST_EQ(lazy[i].get_value(), owned[i].get_value());
+        CPPLEXER_TEST(lazy[i] == owned[i]);
+    }
+}
+
+// copies of a token share its data, the value of a lazy token may be
+// materialized by any number of threads at the same time
+void test_concurrent_access(std::string const& file)
+{
+    auto const owned = lex(file, cpplexer::token_values::owned);
+
+    std::vector<cpplexer::token_type> lazy;
+    auto range = cpplexer::tokenize(file, cpplexer::token_values::lazy);
+    for (auto const& token : range)
+        lazy.push_back(token);
+
+    constexpr std::size_t thread_count = 4;
+    std::vector<std::size_t> mismatches(thread_count, 0);
+    {
+        // the copies are made up front, the reference counts are not
+        // thread safe
+        std::vector<std::vector<cpplexer::token_type>> copies(
+            thread_count, lazy);
+
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t != thread_count; ++t)
+        {
+            threads.emplace_back([&, t]() {
+                auto const& tokens = copies[t];
+                for (std::size_t i = 0; i != tokens.size(); ++i)
+                {
+                    if (i >= owned.size() ||
+                        tokens[i].get_value() != owned[i].get_value() ||
+                        !(tokens[i] == owned[i]))
+                    {
+                        ++mismatches[t];
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    for (std::size_t count : mismatches)
+        CPPLEXER_TEST_EQ(count, 0u);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    fs::path const file =
+        fs::temp_directory_path() / "cpplexer_test_lazy_token_values.cpp";
+    {
+        std::ofstream out(file, std::ios::binary);
+        for (int i = 0; i != 200; ++i)
+        {
+            out << "#include <header_" << i << ".hpp>\n"
+                << "// a comment long enough not to fit into a small string\n"
+                << "int function_" << i << "(int argument) { return "
+                << "argument * " << i << " + 0x" << i << "; }\n"
+                << "char const* text_" << i << " = \"a string literal\";\n";
+        }
+    }
+
+    test_values(file.string());
+    test_concurrent_access(file.string());
+
+    std::error_code ec;
+    fs::remove(file, ec);
+
+    return test::report_errors();
+}
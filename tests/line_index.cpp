@@ -0,0 +1,161 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpplexer.hpp>
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+///////////////////////////////////////////////////////////////////////////////
+// the line starts of a text ('\n', '\r\n' and a single '\r' end a line)
+std::vector<std::uint32_t> reference_starts(std::string_view text)
+{
+    std::vector<std::uint32_t> starts(1, 0);
+    for (std::size_t i = 0; i != text.size(); ++i)
+    {
+        if (text[i] == '\n' ||
+            (text[i] == '\r' && (i + 1 == text.size() || text[i + 1] != '\n')))
+        {
+            starts.push_back(static_cast<std::uint32_t>(i + 1));
+        }
+    }
+    return starts;
+}
+
+void add_chunks(
+    cpplexer::line_index& lines, std::string_view text, std::size_t chunk)
+{
+    for (std::size_t offset = 0; offset < text.size(); offset += chunk)
+    {
+        std::size_t const size = (std::min)(chunk, text.size() - offset);
+        lines.add_chunk(
+            reinterpret_cast<unsigned char const*>(text.data()) + offset,
+            size, offset, {}, offset + size == text.size());
+    }
+}
+
+bool equal(std::span<std::uint32_t const> lhs,
+    std::vector<std::uint32_t> const& rhs)
+{
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+// the line starts don't depend on how the input is split into chunks
+void test_chunks(std::string_view text)
+{
+    auto const expected = reference_starts(text);
+    for (std::size_t chunk = 1; chunk <= text.size(); ++chunk)
+    {
+        cpplexer::line_index lines;
+        add_chunks(lines, text, chunk);
+        CPPLEXER_TEST(equal(lines.line_starts(), expected));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the lines and columns found in the index are the ones reported by the
+// lexer for each of the tokens, the lexer continues counting the columns
+// of a logical line after a line splice though
+void test_tokens(std::string const& file, bool check_columns)
+{
+    cpplexer::token_soa_buffer tokens;
+    cpplexer::tokenize(file, tokens);
+    CPPLEXER_TEST(!tokens.empty());
+
+    auto const& lines = tokens.line_table();
+    for (std::size_t i = 0; i != tokens.size(); ++i)
+    {
+        std::size_t const offset = tokens.offsets()[i];
+        CPPLEXER_TEST_EQ(lines.line(offset), tokens.lines()[i]);
+        if (check_columns)
+            CPPLEXER_TEST_EQ(lines.column(offset), tokens.columns()[i]);
+    }
+}
+
+// the time spent recording the line starts compared to lexing the input
+void report_overhead(std::string const& file, std::string const& text)
+{
+    using clock = std::chrono::steady_clock;
+
+    using milliseconds = std::chrono::duration<double, std::milli>;
+
+    milliseconds index_time(1e9);
+    milliseconds lex_time(1e9);
+    for (int i = 0; i != 5; ++i)
+    {
+        auto const start = clock::now();
+        cpplexer::line_index lines;
+        add_chunks(lines, text, 65536);
+        auto const indexed = clock::now();
+
+        cpplexer::token_soa_buffer tokens;
+        cpplexer::tokenize(file, tokens);
+        auto const lexed = clock::now();
+
+        index_time = (std::min)(index_time, milliseconds(indexed - start));
+        lex_time = (std::min)(lex_time, milliseconds(lexed - indexed));
+    }
+
+    std::cout << "line index: " << index_time.count() << " ms, lexing: "
+              << lex_time.count() << " ms (" << text.size() << " bytes)\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_chunks("");
+    test_chunks("\n");
+    test_chunks("\r");
+    test_chunks("\r\n");
+    test_chunks("a\nb\r\nc\rd\r\r\n\n\re\r");
+    test_chunks("\n\r\n\r\r\n\r\r\r\n\n\nlast line");
+
+    fs::path const file =
+        fs::temp_directory_path() / "cpplexer_test_line_index.cpp";
+    auto const write = [&file](std::string const& text) {
+        std::ofstream out(file, std::ios::binary);
+        out << text;
+    };
+
+    std::string text;
+    for (int i = 0; i != 100; ++i)
+    {
+        text += "#define MACRO_" + std::to_string(i) + " \\\n    " +
+            std::to_string(i) + " \\\r\n + 1\n";
+    }
+    write(text);
+    test_tokens(file.string(), false);
+
+    text.clear();
+    for (int i = 0; i != 20000; ++i)
+    {
+        text += "int function_" + std::to_string(i) +
+            "(int argument)\r\n{\r\n    return argument; // comment\r\n}\n";
+        text += "/* a comment\r   spanning lines */ char c = '\\n';\n";
+    }
+    write(text);
+    test_tokens(file.string(), true);
+    report_overhead(file.string(), text);
+
+    std::error_code ec;
+    fs::remove(file, ec);
+
+    return test::report_errors();
+}
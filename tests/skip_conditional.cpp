@@ -0,0 +1,66 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpplexer.hpp>
+
+#include "test.hpp"
+
+#include <cstddef>
+#include <string_view>
+
+///////////////////////////////////////////////////////////////////////////////
+//  Skip the block following the first line of the input, the token
+//  terminating it has to be at the given position. The position of a T_EOF
+//  has to be the same as if all tokens were lexed (unless lexing the input
+//  reports an error).
+void check_skip(std::string_view text, wave::token_id id, std::size_t line,
+    std::size_t column, bool compare_lexed = true)
+{
+    auto range = cpplexer::tokenize(text, "test.cpp");
+    auto it = range.begin();
+    while (it != range.end() && wave::token_id(*it) != wave::T_NEWLINE)
+        ++it;
+    if (it == range.end())
+    {
+        CPPLEXER_TEST(it != range.end());
+        return;
+    }
+
+    it.skip_to_matching_conditional();
+    CPPLEXER_TEST_EQ(wave::token_id(*it), id);
+    CPPLEXER_TEST_EQ(it->get_position().get_line(), line);
+    CPPLEXER_TEST_EQ(it->get_position().get_column(), column);
+
+    if (id == wave::T_EOF && compare_lexed)
+    {
+        auto lexed = cpplexer::tokenize(text, "test.cpp");
+        cpplexer::position_type eof;
+        for (auto const& token : lexed)
+        {
+            if (wave::token_id(token) == wave::T_EOF)
+                eof = token.get_position();
+        }
+        CPPLEXER_TEST_EQ(eof.get_line(), line);
+        CPPLEXER_TEST_EQ(eof.get_column(), column);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    check_skip("#if 0\nint i;\n#endif\n", wave::T_PP_ENDIF, 3, 1);
+    check_skip(
+        "#if 0\n#if 1\n#else\n#endif\n /**/ #else\n", wave::T_PP_ELSE, 5, 7);
+
+    // an unterminated block ends at the end of the input
+    check_skip("#if 0\nint abc = \"xy\"; // c\nfoo", wave::T_EOF, 3, 4);
+    check_skip("#if 0\nint abc = 'x' + 1'000;\n  R\"d(a\nbc)d\" x /* y */ z",
+        wave::T_EOF, 4, 18);
+    check_skip("#if 0\nx = \"abc", wave::T_EOF, 2, 9);
+    check_skip("#if 0\nx = // abc", wave::T_EOF, 2, 11, false);
+
+    return test::report_errors();
+}
@@ -0,0 +1,52 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <iostream>
+
+///////////////////////////////////////////////////////////////////////////////
+//  Minimal test support: CPPLEXER_TEST(expr) and CPPLEXER_TEST_EQ(lhs, rhs)
+//  report a failed check and continue, report_errors() is returned from
+//  main().
+namespace test {
+
+    inline int failures = 0;
+
+    inline void check(
+        bool result, char const* expr, char const* file, int line)
+    {
+        if (!result)
+        {
+            ++failures;
+            std::cerr << file << "(" << line << "): test failed: " << expr
+                      << "\n";
+        }
+    }
+
+    template <typename T, typename U>
+    void check_equal(T const& lhs, U const& rhs, char const* expr,
+        char const* file, int line)
+    {
+        if (!(lhs == rhs))
+        {
+            ++failures;
+            std::cerr << file << "(" << line << "): test failed: " << expr
+                      << " ('" << lhs << "' != '" << rhs << "')\n";
+        }
+    }
+
+    inline int report_errors()
+    {
+        if (failures != 0)
+            std::cerr << failures << " test(s) failed\n";
+        return failures == 0 ? 0 : 1;
+    }
+}    // namespace test
+
+#define CPPLEXER_TEST(expr) ::test::check((expr), #expr, __FILE__, __LINE__)
+#define CPPLEXER_TEST_EQ(lhs, rhs)                                             \
+    ::test::check_equal((lhs), (rhs), #lhs " == " #rhs, __FILE__, __LINE__)
@@ -0,0 +1,176 @@
+//  Copyright (c) 2023 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpplexer.hpp>
+
+#include "test.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+///////////////////////////////////////////////////////////////////////////////
+//  the known answers of MurmurHash3 (x64, 128 bit, seed 0)
+void test_hash128()
+{
+    struct known_answer
+    {
+        std::string_view input;
+        std::uint64_t low;
+        std::uint64_t high;
+    };
+    static constexpr known_answer answers[] = {
+        {"", 0, 0},
+        {"hello", 0xcbd8a7b341bd9b02ULL, 0x5b1e906a48ae1d19ULL},
+        {"The quick brown fox jumps over the lazy dog",
+            0xe34bbc7bbc071b6cULL, 0x7a433ca9c49a9347ULL},
+    };
+
+    for (known_answer const& answer : answers)
+    {
+        // the result must not depend on how the input is split
+        for (std::size_t split = 0; split <= answer.input.size(); ++split)
+        {
+            wave::cpplexer::hash128 hash;
+            hash.update(answer.input.data(), split);
+            hash.update(
+                answer.input.data() + split, answer.input.size() - split);
+
+            auto const result = hash.finalize();
+            CPPLEXER_TEST_EQ(result.low, answer.low);
+            CPPLEXER_TEST_EQ(result.high, answer.high);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//  the fingerprints computed from the token_soa_buffer passed to a
+//  directory_sink
+struct fingerprint_sink : cpplexer::directory_sink
+{
+    struct result
+    {
+        cpplexer::token_fingerprint fingerprint;
+        std::vector<cpplexer::declaration_fingerprint> declarations;
+    };
+
+    void consume(std::size_t, fs::path const& file,
+        cpplexer::token_soa_buffer const& tokens) override
+    {
+        result r;
+        r.fingerprint = cpplexer::fingerprint(tokens, &r.declarations);
+
+        std::lock_guard<std::mutex> l(mtx);
+        results[file.filename().string()] = std::move(r);
+    }
+
+    void failed(std::size_t, fs::path const&, std::exception_ptr) override
+    {
+        ++failures;
+    }
+
+    std::mutex mtx;
+    std::map<std::string, result> results;
+    std::size_t failures = 0;
+};
+
+void write_file(fs::path const& path, std::string_view contents)
+{
+    std::ofstream out(path, std::ios::binary);
+    out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+void test_directory(fs::path const& directory,
+    std::vector<std::string> const& files, bool pipelined)
+{
+    fingerprint_sink sink;
+    cpplexer::directory_lexer_options options;
+    options.threads = 2;
+    options.pipelined = pipelined;
+
+    auto const stats = cpplexer::tokenize_directory(directory, sink, options);
+    CPPLEXER_TEST_EQ(stats.files, files.size());
+    CPPLEXER_TEST_EQ(sink.failures, 0u);
+    CPPLEXER_TEST_EQ(sink.results.size(), files.size());
+
+    for (std::string const& name : files)
+    {
+        std::vector<cpplexer::declaration_fingerprint> declarations;
+        auto const expected =
+            cpplexer::fingerprint((directory / name).string(), &declarations);
+
+        auto const it = sink.results.find(name);
+        if (it == sink.results.end())
+        {
+            CPPLEXER_TEST(it != sink.results.end());
+            continue;
+        }
+
+        CPPLEXER_TEST(it->second.fingerprint == expected);
+        CPPLEXER_TEST_EQ(
+            it->second.declarations.size(), declarations.size());
+        if (it->second.declarations.size() != declarations.size())
+            continue;
+
+        for (std::size_t i = 0; i != declarations.size(); ++i)
+        {
+            auto const& lhs = it->second.declarations[i];
+            auto const& rhs = declarations[i];
+            CPPLEXER_TEST(lhs.fingerprint == rhs.fingerprint);
+            CPPLEXER_TEST_EQ(lhs.first_line, rhs.first_line);
+            CPPLEXER_TEST_EQ(lhs.last_line, rhs.last_line);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_hash128();
+
+    fs::path const directory =
+        fs::temp_directory_path() / "cpplexer_test_token_fingerprint";
+    fs::remove_all(directory);
+    fs::create_directories(directory);
+
+    std::vector<std::string> const files = {"a.hpp", "b.cpp", "c.h"};
+    write_file(directory / files[0],
+        "#pragma once\n#include <vector>\n\nstruct a\n{\n    int i;\n};\n");
+    write_file(directory / files[1],
+        "#include \"a.hpp\"\n// comment\nint f(int i) { return i; }\n"
+        "auto s = R\"x(raw\nstring)x\";\nint g() \\\n{ return 1; }\n");
+    write_file(directory / files[2],
+        "#ifndef C_H\n#define C_H\n/* a\n   b */ enum e { x, y };\n#endif\n");
+
+    test_directory(directory, files, false);
+    test_directory(directory, files, true);
+
+    // the same token sequence has the same fingerprint
+    {
+        cpplexer::token_soa_buffer lhs, rhs;
+        write_file(directory / "d.cpp", "int   i =\n 1 ; // x\n");
+        write_file(directory / "e.cpp", "int i = 1; /* y */\n");
+        cpplexer::tokenize((directory / "d.cpp").string(), lhs);
+        cpplexer::tokenize((directory / "e.cpp").string(), rhs);
+        CPPLEXER_TEST(
+            cpplexer::fingerprint(lhs) == cpplexer::fingerprint(rhs));
+    }
+
+    std::error_code ec;
+    fs::remove_all(directory, ec);
+
+    return test::report_errors();
+}